@@ -0,0 +1,307 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "base/process/process_metrics.h"
+#include "base/run_loop.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/task_runner.h"
+#include "base/threading/thread_restrictions.h"
+#include "base/time/time.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/browser/brave_browser_process_impl.h"
+#include "brave/browser/brave_shields/ad_block_service_browsertest.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "content/public/test/browser_test.h"
+#include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
+#include "url/gurl.h"
+
+// Replays a recorded request corpus through the adblock services and reports
+// engine build time, matching throughput, latency percentiles and RSS.
+//
+// npm run test -- brave_browser_tests
+//     --filter=AdBlockServiceBenchmarkTest.*
+//     --gtest_also_run_disabled_tests
+//     [--adblock-benchmark-data-dir=<dir>]
+//
+// The data dir defaults to test/data/adblock-data/benchmark. It holds the
+// corpus in requests.tsv (url, source host and resource type separated by
+// tabs) and the custom filters in custom_filters.txt. If it also holds a
+// default_rules.txt, e.g. a full EasyList, the default engine is built from it
+// instead of the adblock-default test component, so that real lists can be
+// measured without packaging them as components.
+
+namespace {
+
+constexpr char kBenchmarkDataDirSwitch[] = "adblock-benchmark-data-dir";
+
+constexpr char kAdBlockEasyListFranceUUID[] =
+    "9852EFC4-99E4-4F2D-A915-9C3196C7A1DE";
+
+// Every request of the corpus is replayed this many times.
+constexpr int kReplayRounds = 100;
+
+constexpr const char* kClasses[] = {"ad", "ad-banner", "sponsored-banner",
+                                    "content", "header", "footer"};
+constexpr const char* kIds[] = {"ad-slot", "main", "sidebar", "comments"};
+
+struct RecordedRequest {
+  GURL url;
+  std::string source_host;
+  blink::mojom::ResourceType resource_type;
+};
+
+blink::mojom::ResourceType ResourceTypeFromString(const std::string& type) {
+  static const std::map<std::string, blink::mojom::ResourceType> types = {
+      {"main_frame", blink::mojom::ResourceType::kMainFrame},
+      {"sub_frame", blink::mojom::ResourceType::kSubFrame},
+      {"stylesheet", blink::mojom::ResourceType::kStylesheet},
+      {"script", blink::mojom::ResourceType::kScript},
+      {"image", blink::mojom::ResourceType::kImage},
+      {"font", blink::mojom::ResourceType::kFontResource},
+      {"media", blink::mojom::ResourceType::kMedia},
+      {"xhr", blink::mojom::ResourceType::kXhr},
+      {"ping", blink::mojom::ResourceType::kPing},
+  };
+  const auto it = types.find(type);
+  return it == types.end() ? blink::mojom::ResourceType::kSubResource
+                           : it->second;
+}
+
+std::vector<RecordedRequest> ParseRequests(const std::string& corpus) {
+  std::vector<RecordedRequest> requests;
+  for (const auto& line : base::SplitStringPiece(
+           corpus, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (base::StartsWith(line, "#"))
+      continue;
+
+    const auto fields = base::SplitString(line, "\t", base::TRIM_WHITESPACE,
+                                          base::SPLIT_WANT_ALL);
+    if (fields.size() != 3 || !GURL(fields[0]).is_valid()) {
+      LOG(WARNING) << "Skipping malformed request: " << line;
+      continue;
+    }
+
+    requests.push_back(
+        {GURL(fields[0]), fields[1], ResourceTypeFromString(fields[2])});
+  }
+  return requests;
+}
+
+size_t GetResidentSetSizeKB() {
+#if defined(OS_LINUX) || defined(OS_CHROMEOS) || defined(OS_ANDROID)
+  return base::ProcessMetrics::CreateCurrentProcessMetrics()
+             ->GetResidentSetSize() /
+         1024;
+#else
+  return 0;
+#endif
+}
+
+void ReportLatencies(const std::string& name,
+                     std::vector<base::TimeDelta> latencies) {
+  if (latencies.empty())
+    return;
+
+  base::TimeDelta total;
+  for (const auto& latency : latencies)
+    total += latency;
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto percentile = [&latencies](size_t percent) {
+    return latencies[(latencies.size() - 1) * percent / 100];
+  };
+  LOG(INFO) << name << ": " << latencies.size() << " calls, "
+            << (total.is_zero() ? 0 : latencies.size() / total.InSecondsF())
+            << " calls/s, p50 " << percentile(50).InMicroseconds()
+            << "us, p99 " << percentile(99).InMicroseconds() << "us";
+}
+
+}  // namespace
+
+class AdBlockServiceBenchmarkTest : public AdBlockServiceTest {
+ public:
+  AdBlockServiceBenchmarkTest() {}
+
+ protected:
+  base::FilePath GetBenchmarkDataDir() {
+    const auto* command_line = base::CommandLine::ForCurrentProcess();
+    if (command_line->HasSwitch(kBenchmarkDataDirSwitch))
+      return command_line->GetSwitchValuePath(kBenchmarkDataDirSwitch);
+
+    base::FilePath test_data_dir;
+    GetTestDataDir(&test_data_dir);
+    return test_data_dir.AppendASCII("adblock-data").AppendASCII("benchmark");
+  }
+
+  // Builds an engine the way the services do, to measure it separately from
+  // installing the component.
+  void ReportDATEngineBuildTime(const std::string& name,
+                                const base::FilePath& dat_file_path) {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    base::ElapsedTimer timer;
+    auto result = brave_component_updater::LoadDATFileData<adblock::Engine>(
+        dat_file_path);
+    EXPECT_TRUE(result.first) << dat_file_path;
+    LOG(INFO) << name << " engine build: " << timer.Elapsed().InMilliseconds()
+              << "ms, " << result.second.size() << " bytes";
+  }
+
+  void ReportRulesEngineBuildTime(const std::string& name,
+                                  const std::string& rules) {
+    base::ElapsedTimer timer;
+    adblock::Engine engine(rules);
+    LOG(INFO) << name << " engine build: " << timer.Elapsed().InMilliseconds()
+              << "ms, " << rules.size() << " bytes";
+  }
+
+  // Runs |task| on the adblock matching task runner, where requests are
+  // matched in the browser.
+  void RunOnMatchingTaskRunner(base::OnceClosure task) {
+    base::RunLoop run_loop;
+    g_brave_browser_process->ad_block_service()
+        ->GetMatchingTaskRunner()
+        ->PostTaskAndReply(FROM_HERE, std::move(task), run_loop.QuitClosure());
+    run_loop.Run();
+  }
+};
+
+IN_PROC_BROWSER_TEST_F(AdBlockServiceBenchmarkTest, DISABLED_ReplayCorpus) {
+  const base::FilePath data_dir = GetBenchmarkDataDir();
+  base::FilePath test_data_dir;
+  GetTestDataDir(&test_data_dir);
+
+  std::string corpus;
+  std::string custom_filters;
+  std::string default_rules;
+  {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    ASSERT_TRUE(base::ReadFileToString(data_dir.AppendASCII("requests.tsv"),
+                                       &corpus));
+    ASSERT_TRUE(base::ReadFileToString(
+        data_dir.AppendASCII("custom_filters.txt"), &custom_filters));
+    base::ReadFileToString(data_dir.AppendASCII("default_rules.txt"),
+                           &default_rules);
+  }
+  const std::vector<RecordedRequest> requests = ParseRequests(corpus);
+  ASSERT_FALSE(requests.empty());
+
+  const size_t initial_rss_kb = GetResidentSetSizeKB();
+
+  // Engine build times.
+  if (default_rules.empty()) {
+    ReportDATEngineBuildTime("default",
+                             test_data_dir.AppendASCII("adblock-data")
+                                 .AppendASCII("adblock-default")
+                                 .AppendASCII("rs-ABPFilterParserData.dat"));
+  } else {
+    ReportRulesEngineBuildTime("default", default_rules);
+  }
+  ReportDATEngineBuildTime(
+      "regional", test_data_dir.AppendASCII("adblock-data")
+                      .AppendASCII("adblock-regional")
+                      .AppendASCII(kAdBlockEasyListFranceUUID)
+                      .AppendASCII(std::string("rs-") +
+                                   kAdBlockEasyListFranceUUID + ".dat"));
+  ReportRulesEngineBuildTime("custom", custom_filters);
+
+  // Load the lists into the services.
+  if (default_rules.empty()) {
+    ASSERT_TRUE(InstallDefaultAdBlockExtension());
+  } else {
+    UpdateAdBlockInstanceWithRules(default_rules);
+  }
+  ASSERT_TRUE(InstallRegionalAdBlockExtension(kAdBlockEasyListFranceUUID));
+  ASSERT_TRUE(StartAdBlockRegionalServices());
+  ASSERT_TRUE(g_brave_browser_process->ad_block_custom_filters_service()
+                  ->UpdateCustomFilters(custom_filters));
+  WaitForAdBlockServiceThreads();
+
+  const size_t loaded_rss_kb = GetResidentSetSizeKB();
+
+  brave_shields::AdBlockService* service =
+      g_brave_browser_process->ad_block_service();
+
+  std::set<std::string> source_hosts;
+  for (const auto& request : requests)
+    source_hosts.insert(request.source_host);
+  const std::vector<std::string> classes(std::begin(kClasses),
+                                         std::end(kClasses));
+  const std::vector<std::string> ids(std::begin(kIds), std::end(kIds));
+
+  std::vector<base::TimeDelta> request_latencies;
+  std::vector<base::TimeDelta> cosmetic_resources_latencies;
+  std::vector<base::TimeDelta> hidden_selectors_latencies;
+  size_t blocked_count = 0;
+  RunOnMatchingTaskRunner(base::BindOnce(
+      [](brave_shields::AdBlockService* service,
+         const std::vector<RecordedRequest>* requests,
+         const std::set<std::string>* source_hosts,
+         const std::vector<std::string>* classes,
+         const std::vector<std::string>* ids,
+         std::vector<base::TimeDelta>* request_latencies,
+         std::vector<base::TimeDelta>* cosmetic_resources_latencies,
+         std::vector<base::TimeDelta>* hidden_selectors_latencies,
+         size_t* blocked_count) {
+        for (int round = 0; round < kReplayRounds; ++round) {
+          for (const auto& request : *requests) {
+            bool did_match_rule = false;
+            bool did_match_exception = false;
+            bool did_match_important = false;
+            std::string mock_data_url;
+            base::ElapsedTimer timer;
+            service->ShouldStartRequest(
+                request.url, request.resource_type, request.source_host,
+                &did_match_rule, &did_match_exception, &did_match_important,
+                &mock_data_url);
+            request_latencies->push_back(timer.Elapsed());
+            if (round == 0 && did_match_rule && !did_match_exception)
+              (*blocked_count)++;
+          }
+
+          for (const auto& source_host : *source_hosts) {
+            base::ElapsedTimer cosmetic_resources_timer;
+            service->UrlCosmeticResources("https://" + source_host + "/");
+            cosmetic_resources_latencies->push_back(
+                cosmetic_resources_timer.Elapsed());
+
+            base::ElapsedTimer hidden_selectors_timer;
+            service->HiddenClassIdSelectors(*classes, *ids, {});
+            hidden_selectors_latencies->push_back(
+                hidden_selectors_timer.Elapsed());
+          }
+        }
+      },
+      service, &requests, &source_hosts, &classes, &ids, &request_latencies,
+      &cosmetic_resources_latencies, &hidden_selectors_latencies,
+      &blocked_count));
+
+  LOG(INFO) << requests.size() << " recorded requests, " << blocked_count
+            << " blocked";
+  ReportLatencies("ShouldStartRequest", std::move(request_latencies));
+  ReportLatencies("UrlCosmeticResources",
+                  std::move(cosmetic_resources_latencies));
+  ReportLatencies("HiddenClassIdSelectors",
+                  std::move(hidden_selectors_latencies));
+  LOG(INFO) << "RSS: " << initial_rss_kb << "KB before loading the lists, "
+            << loaded_rss_kb << "KB after, " << GetResidentSetSizeKB()
+            << "KB after matching";
+}
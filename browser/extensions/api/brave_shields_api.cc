@@ -51,7 +51,7 @@ BraveShieldsUrlCosmeticResourcesFunction::Run() {
       brave_shields::UrlCosmeticResources::Params::Create(*args_));
   EXTENSION_FUNCTION_VALIDATE(params.get());
   g_brave_browser_process->ad_block_service()
-      ->GetTaskRunner()
+      ->GetMatchingTaskRunner()
       ->PostTaskAndReplyWithResult(
           FROM_HERE,
           base::BindOnce(&BraveShieldsUrlCosmeticResourcesFunction::
@@ -93,7 +93,7 @@ BraveShieldsHiddenClassIdSelectorsFunction::Run() {
       brave_shields::HiddenClassIdSelectors::Params::Create(*args_));
   EXTENSION_FUNCTION_VALIDATE(params.get());
   g_brave_browser_process->ad_block_service()
-      ->GetTaskRunner()
+      ->GetMatchingTaskRunner()
       ->PostTaskAndReplyWithResult(
           FROM_HERE,
           base::BindOnce(&BraveShieldsHiddenClassIdSelectorsFunction::
@@ -0,0 +1,51 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_ad_block_cname_cache.h"
+
+#include "base/no_destructor.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+constexpr size_t BraveAdBlockCnameCache::kMaxEntries;
+
+BraveAdBlockCnameCache::BraveAdBlockCnameCache() : entries_(kMaxEntries) {}
+
+BraveAdBlockCnameCache::~BraveAdBlockCnameCache() = default;
+
+// static
+BraveAdBlockCnameCache* BraveAdBlockCnameCache::GetInstance() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<BraveAdBlockCnameCache> instance;
+  return instance.get();
+}
+
+base::Optional<std::string> BraveAdBlockCnameCache::Get(
+    const net::NetworkIsolationKey& network_isolation_key,
+    const std::string& host) {
+  auto it = entries_.Get(Key(network_isolation_key, host));
+  if (it == entries_.end())
+    return base::nullopt;
+
+  return it->second;
+}
+
+void BraveAdBlockCnameCache::Put(
+    const net::NetworkIsolationKey& network_isolation_key,
+    const std::string& host,
+    const std::string& canonical_name) {
+  entries_.Put(Key(network_isolation_key, host), canonical_name);
+}
+
+void BraveAdBlockCnameCache::Erase(
+    const net::NetworkIsolationKey& network_isolation_key,
+    const std::string& host) {
+  auto it = entries_.Peek(Key(network_isolation_key, host));
+  if (it != entries_.end())
+    entries_.Erase(it);
+}
+
+}  // namespace brave
@@ -0,0 +1,55 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_AD_BLOCK_CNAME_CACHE_H_
+#define BRAVE_BROWSER_NET_BRAVE_AD_BLOCK_CNAME_CACHE_H_
+
+#include <string>
+#include <utility>
+
+#include "base/containers/mru_cache.h"
+#include "base/macros.h"
+#include "base/optional.h"
+#include "net/base/network_isolation_key.h"
+
+namespace brave {
+
+// Remembers which canonical name a host resolved to, per network isolation
+// key, so CNAME uncloaking doesn't need a host resolution round trip for every
+// subresource. Must be used on the UI thread.
+//
+// The resolver API doesn't expose record TTLs, so entries don't expire on
+// their own. Callers revalidate an entry against the host resolver whenever
+// they use it, and the resolver's own cache follows the TTLs. The answer then
+// replaces the entry, or removes it if the host no longer resolves.
+class BraveAdBlockCnameCache {
+ public:
+  static constexpr size_t kMaxEntries = 1000;
+
+  BraveAdBlockCnameCache();
+  ~BraveAdBlockCnameCache();
+
+  static BraveAdBlockCnameCache* GetInstance();
+
+  base::Optional<std::string> Get(
+      const net::NetworkIsolationKey& network_isolation_key,
+      const std::string& host);
+  void Put(const net::NetworkIsolationKey& network_isolation_key,
+           const std::string& host,
+           const std::string& canonical_name);
+  void Erase(const net::NetworkIsolationKey& network_isolation_key,
+             const std::string& host);
+
+ private:
+  using Key = std::pair<net::NetworkIsolationKey, std::string>;
+
+  base::MRUCache<Key, std::string> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(BraveAdBlockCnameCache);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_AD_BLOCK_CNAME_CACHE_H_
@@ -0,0 +1,50 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_ad_block_cname_cache.h"
+
+#include "net/base/network_isolation_key.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace brave {
+
+class BraveAdBlockCnameCacheTest : public ::testing::Test {
+ protected:
+  net::NetworkIsolationKey CreateKey(const std::string& url) {
+    const url::Origin origin = url::Origin::Create(GURL(url));
+    return net::NetworkIsolationKey(origin, origin);
+  }
+
+  BraveAdBlockCnameCache cache_;
+};
+
+TEST_F(BraveAdBlockCnameCacheTest, ReturnsCachedCanonicalName) {
+  const auto key = CreateKey("https://a.com");
+  EXPECT_FALSE(cache_.Get(key, "metrics.a.com"));
+
+  cache_.Put(key, "metrics.a.com", "a.tracker.com");
+  EXPECT_EQ(cache_.Get(key, "metrics.a.com"), "a.tracker.com");
+  EXPECT_FALSE(cache_.Get(key, "www.a.com"));
+}
+
+TEST_F(BraveAdBlockCnameCacheTest, IsPartitionedByNetworkIsolationKey) {
+  cache_.Put(CreateKey("https://a.com"), "cdn.example.com", "a.cdn.net");
+  EXPECT_FALSE(cache_.Get(CreateKey("https://b.com"), "cdn.example.com"));
+}
+
+TEST_F(BraveAdBlockCnameCacheTest, RevalidationReplacesOrErasesEntries) {
+  const auto key = CreateKey("https://a.com");
+  cache_.Put(key, "metrics.a.com", "a.tracker.com");
+
+  cache_.Put(key, "metrics.a.com", "b.tracker.com");
+  EXPECT_EQ(cache_.Get(key, "metrics.a.com"), "b.tracker.com");
+
+  cache_.Erase(key, "metrics.a.com");
+  EXPECT_FALSE(cache_.Get(key, "metrics.a.com"));
+}
+
+}  // namespace brave
@@ -11,9 +11,14 @@
 #include <vector>
 
 #include "base/base64url.h"
+#include "base/callback_helpers.h"
 #include "base/feature_list.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_util.h"
+#include "base/task/post_task.h"
+#include "base/time/time.h"
 #include "brave/browser/brave_browser_process_impl.h"
+#include "brave/browser/net/brave_ad_block_cname_cache.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/url_constants.h"
@@ -26,6 +31,7 @@
 #include "chrome/browser/net/secure_dns_config.h"
 #include "chrome/browser/net/system_network_context_manager.h"
 #include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/storage_partition.h"
@@ -57,47 +63,58 @@ content::WebContents* GetWebContents(int render_process_id,
   return web_contents;
 }
 
-}  // namespace
-
-void ShouldBlockAdOnTaskRunner(std::shared_ptr<BraveRequestInfo> ctx,
-                               base::Optional<std::string> canonical_name) {
+struct AdBlockMatch {
   bool did_match_rule = false;
   bool did_match_exception = false;
   bool did_match_important = false;
+};
+
+bool ShouldBlockMatch(const AdBlockMatch& match) {
+  return match.did_match_important ||
+         (match.did_match_rule && !match.did_match_exception);
+}
+
+}  // namespace
+
+AdBlockMatch ShouldBlockAdOnTaskRunner(std::shared_ptr<BraveRequestInfo> ctx) {
+  AdBlockMatch match;
   if (!ctx->initiator_url.is_valid()) {
-    return;
+    return match;
   }
-  std::string source_host = ctx->initiator_url.host();
 
   g_brave_browser_process->ad_block_service()->ShouldStartRequest(
-      ctx->request_url, ctx->resource_type, source_host, &did_match_rule,
-      &did_match_exception, &did_match_important, &ctx->mock_data_url);
-  if (did_match_important) {
+      ctx->request_url, ctx->resource_type, ctx->initiator_url.host(),
+      &match.did_match_rule, &match.did_match_exception,
+      &match.did_match_important, &ctx->mock_data_url);
+  if (ShouldBlockMatch(match)) {
     ctx->blocked_by = kAdBlocked;
-    return;
   }
+  return match;
+}
 
-  if (canonical_name.has_value() &&
-      ctx->request_url.host() != *canonical_name && *canonical_name != "") {
-    GURL::Replacements replacements = GURL::Replacements();
-    replacements.SetHost(
-        canonical_name->c_str(),
-        url::Component(0, static_cast<int>(canonical_name->length())));
-    const GURL canonical_url = ctx->request_url.ReplaceComponents(replacements);
-
-    g_brave_browser_process->ad_block_service()->ShouldStartRequest(
-        canonical_url, ctx->resource_type, source_host, &did_match_rule,
-        &did_match_exception, &did_match_important, &ctx->mock_data_url);
-  }
+// Re-checks the request as if it had been made to the host it is cloaked
+// behind. Rules and exceptions matched by the original URL still apply.
+void ShouldBlockCanonicalAdOnTaskRunner(std::shared_ptr<BraveRequestInfo> ctx,
+                                        AdBlockMatch match,
+                                        const std::string& canonical_name) {
+  GURL::Replacements replacements = GURL::Replacements();
+  replacements.SetHost(
+      canonical_name.c_str(),
+      url::Component(0, static_cast<int>(canonical_name.length())));
+  const GURL canonical_url = ctx->request_url.ReplaceComponents(replacements);
 
-  if (did_match_important || (did_match_rule && !did_match_exception)) {
+  g_brave_browser_process->ad_block_service()->ShouldStartRequest(
+      canonical_url, ctx->resource_type, ctx->initiator_url.host(),
+      &match.did_match_rule, &match.did_match_exception,
+      &match.did_match_important, &ctx->mock_data_url);
+  if (ShouldBlockMatch(match)) {
     ctx->blocked_by = kAdBlocked;
   }
 }
 
+// May run on the UI thread or on the request handler's network sequence.
 void OnShouldBlockAdResult(const ResponseCallback& next_callback,
                            std::shared_ptr<BraveRequestInfo> ctx) {
-  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   if (ctx->blocked_by == kAdBlocked) {
     brave_shields::DispatchBlockedEvent(
         ctx->request_url, ctx->render_frame_id, ctx->render_process_id,
@@ -107,30 +124,56 @@ void OnShouldBlockAdResult(const ResponseCallback& next_callback,
 }
 
 void ShouldBlockAdWithOptionalCname(
-    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    scoped_refptr<base::TaskRunner> task_runner,
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx,
+    const AdBlockMatch& match,
     const base::Optional<std::string> cname) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!cname.has_value() || cname->empty() ||
+      *cname == ctx->request_url.host()) {
+    OnShouldBlockAdResult(next_callback, ctx);
+    return;
+  }
+
   task_runner->PostTaskAndReply(
-      FROM_HERE, base::BindOnce(&ShouldBlockAdOnTaskRunner, ctx, cname),
+      FROM_HERE,
+      base::BindOnce(&ShouldBlockCanonicalAdOnTaskRunner, ctx, match, *cname),
       base::BindOnce(&OnShouldBlockAdResult, next_callback, ctx));
 }
 
+// Records how long uncloaking took, up to the end of the second matching pass.
+void RecordUncloakTime(base::TimeTicks start_time,
+                       bool cached,
+                       const ResponseCallback& next_callback) {
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start_time;
+  if (cached) {
+    UMA_HISTOGRAM_TIMES("Brave.ShieldsCNAMEBlocking.TotalResolutionTime.Cached",
+                        elapsed);
+  } else {
+    UMA_HISTOGRAM_TIMES(
+        "Brave.ShieldsCNAMEBlocking.TotalResolutionTime.Uncached", elapsed);
+  }
+  next_callback.Run();
+}
+
+// Resolves the request host and stores its canonical name in the cache. |cb|
+// is null when the lookup only revalidates a cached entry.
 class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
  private:
   mojo::Receiver<network::mojom::ResolveHostClient> receiver_{this};
   base::OnceCallback<void(base::Optional<std::string>)> cb_;
   base::TimeTicks start_time_;
+  net::NetworkIsolationKey network_isolation_key_;
+  std::string host_;
 
  public:
   AdblockCnameResolveHostClient(
-      const ResponseCallback& next_callback,
-      scoped_refptr<base::SequencedTaskRunner> task_runner,
-      std::shared_ptr<BraveRequestInfo> ctx) {
-    cb_ = base::BindOnce(&ShouldBlockAdWithOptionalCname, task_runner,
-                         std::move(next_callback), ctx);
-
+      base::OnceCallback<void(base::Optional<std::string>)> cb,
+      std::shared_ptr<BraveRequestInfo> ctx)
+      : cb_(std::move(cb)),
+        network_isolation_key_(ctx->network_isolation_key),
+        host_(ctx->request_url.host()) {
     auto* web_contents = GetWebContents(
         ctx->render_process_id, ctx->render_frame_id, ctx->frame_tree_node_id);
     if (!web_contents) {
@@ -141,8 +184,6 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
 
     content::BrowserContext* context = web_contents->GetBrowserContext();
 
-    const auto network_isolation_key = ctx->network_isolation_key;
-
     network::mojom::ResolveHostParametersPtr optional_parameters =
         network::mojom::ResolveHostParameters::New();
     optional_parameters->include_canonical_name = true;
@@ -163,7 +204,7 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
     start_time_ = base::TimeTicks::Now();
 
     network_context->ResolveHost(
-        net::HostPortPair::FromURL(ctx->request_url), network_isolation_key,
+        net::HostPortPair::FromURL(ctx->request_url), network_isolation_key_,
         std::move(optional_parameters), receiver_.BindNewPipeAndPassRemote());
 
     receiver_.set_disconnect_handler(
@@ -176,14 +217,20 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
       int32_t result,
       const net::ResolveErrorInfo& resolve_error_info,
       const base::Optional<net::AddressList>& resolved_addresses) override {
-    UMA_HISTOGRAM_TIMES("Brave.ShieldsCNAMEBlocking.TotalResolutionTime",
-                        base::TimeTicks::Now() - start_time_);
+    auto* cache = BraveAdBlockCnameCache::GetInstance();
+    base::Optional<std::string> canonical_name;
     if (result == net::OK && resolved_addresses) {
       DCHECK(resolved_addresses.has_value() && !resolved_addresses->empty());
-      std::move(cb_).Run(
-          base::Optional<std::string>(resolved_addresses->GetCanonicalName()));
+      canonical_name = resolved_addresses->GetCanonicalName();
+      cache->Put(network_isolation_key_, host_, *canonical_name);
     } else {
-      std::move(cb_).Run(base::nullopt);
+      cache->Erase(network_isolation_key_, host_);
+    }
+
+    if (cb_) {
+      UMA_HISTOGRAM_TIMES("Brave.ShieldsCNAMEBlocking.TotalResolutionTime",
+                          base::TimeTicks::Now() - start_time_);
+      std::move(cb_).Run(canonical_name);
     }
 
     delete this;
@@ -200,26 +247,72 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
   }
 };
 
+void UncloakCnameOnUI(scoped_refptr<base::TaskRunner> task_runner,
+                      const ResponseCallback& next_callback,
+                      std::shared_ptr<BraveRequestInfo> ctx,
+                      AdBlockMatch match) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(ctx->browser_context);
+  // DoH or standard DNS quries won't be routed through Tor, so we need to skip
+  // it.
+  if (ctx->browser_context->IsTor()) {
+    OnShouldBlockAdResult(next_callback, ctx);
+    return;
+  }
+
+  const base::TimeTicks start_time = base::TimeTicks::Now();
+  base::Optional<std::string> cached_cname =
+      BraveAdBlockCnameCache::GetInstance()->Get(ctx->network_isolation_key,
+                                                 ctx->request_url.host());
+  const ResponseCallback timed_next_callback = base::BindRepeating(
+      &RecordUncloakTime, start_time, cached_cname.has_value(), next_callback);
+  if (cached_cname.has_value()) {
+    // The resolver answers from its own cache while the record's TTL lasts,
+    // so this keeps the entry current without delaying the request.
+    new AdblockCnameResolveHostClient(base::NullCallback(), ctx);
+    ShouldBlockAdWithOptionalCname(task_runner, timed_next_callback, ctx,
+                                   match, cached_cname);
+    return;
+  }
+
+  new AdblockCnameResolveHostClient(
+      base::BindOnce(&ShouldBlockAdWithOptionalCname, task_runner,
+                     timed_next_callback, ctx, match),
+      ctx);
+}
+
+void OnShouldBlockAdFirstPass(scoped_refptr<base::TaskRunner> task_runner,
+                              const ResponseCallback& next_callback,
+                              std::shared_ptr<BraveRequestInfo> ctx,
+                              AdBlockMatch match) {
+  // The request URL alone decides the outcome, so skip uncloaking.
+  if (ctx->blocked_by == kAdBlocked || !ctx->initiator_url.is_valid()) {
+    OnShouldBlockAdResult(next_callback, ctx);
+    return;
+  }
+
+  // The CNAME cache and the host resolver are only reachable from the UI
+  // thread.
+  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
+                 base::BindOnce(&UncloakCnameOnUI, task_runner, next_callback,
+                                ctx, match));
+}
+
 void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
                                  std::shared_ptr<BraveRequestInfo> ctx) {
-  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   DCHECK_NE(ctx->request_identifier, 0UL);
   DCHECK(!ctx->request_url.is_empty());
   DCHECK(!ctx->initiator_url.is_empty());
 
-  scoped_refptr<base::SequencedTaskRunner> task_runner =
-      g_brave_browser_process->ad_block_service()->GetTaskRunner();
+  scoped_refptr<base::TaskRunner> task_runner =
+      g_brave_browser_process->ad_block_service()->GetMatchingTaskRunner();
 
-  DCHECK(ctx->browser_context);
-  // DoH or standard DNS quries won't be routed through Tor, so we need to skip
-  // it.
-  if (ctx->browser_context->IsTor()) {
-    ShouldBlockAdWithOptionalCname(task_runner, std::move(next_callback), ctx,
-                                   base::nullopt);
-  } else {
-    new AdblockCnameResolveHostClient(std::move(next_callback), task_runner,
-                                      ctx);
-  }
+  // Match the request URL right away; DNS is only consulted when that is not
+  // enough to block the request.
+  task_runner->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&ShouldBlockAdOnTaskRunner, ctx),
+      base::BindOnce(&OnShouldBlockAdFirstPass, task_runner, next_callback,
+                     ctx));
 }
 
 int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
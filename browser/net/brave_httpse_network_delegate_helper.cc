@@ -33,8 +33,6 @@ void OnBeforeURLRequest_HttpseFileWork(
 void OnBeforeURLRequest_HttpsePostFileWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
-  DCHECK_CURRENTLY_ON(BrowserThread::UI);
-
   if (!ctx->new_url_spec.empty() &&
     ctx->new_url_spec != ctx->request_url.spec()) {
     brave_shields::DispatchBlockedEvent(ctx->request_url,
@@ -48,8 +46,6 @@ void OnBeforeURLRequest_HttpsePostFileWork(
 int OnBeforeURLRequest_HttpsePreFileWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
-  DCHECK_CURRENTLY_ON(BrowserThread::UI);
-
   // Don't try to overwrite an already set URL by another delegate (adblock/tp)
   if (!ctx->new_url_spec.empty()) {
     return net::OK;
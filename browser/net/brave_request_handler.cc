@@ -11,6 +11,9 @@
 #include "base/feature_list.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
+#include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
 #include "brave/browser/net/brave_httpse_network_delegate_helper.h"
@@ -59,7 +62,10 @@ static bool IsInternalScheme(std::shared_ptr<brave::BraveRequestInfo> ctx) {
          ctx->request_url.SchemeIs(content::kChromeUIScheme);
 }
 
-BraveRequestHandler::BraveRequestHandler() {
+BraveRequestHandler::BraveRequestHandler()
+    : network_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::USER_BLOCKING,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   SetupCallbacks();
   // Initialize the preference change registrar.
@@ -69,34 +75,49 @@ BraveRequestHandler::BraveRequestHandler() {
 BraveRequestHandler::~BraveRequestHandler() = default;
 
 void BraveRequestHandler::SetupCallbacks() {
-  brave::OnBeforeURLRequestCallback callback =
-      base::Bind(brave::OnBeforeURLRequest_SiteHacksWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::Bind(brave::OnBeforeURLRequest_AdBlockTPPreWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::Bind(brave::OnBeforeURLRequest_HttpsePreFileWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::Bind(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  auto before_url_request_callbacks =
+      std::make_shared<BeforeURLRequestHelpers>();
+  before_url_request_callbacks->push_back(
+      {"SiteHacks",
+       base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork),
+       HelperThread::kNetworkSequence});
+
+  // Hops to the UI thread by itself when CNAME uncloaking is needed.
+  before_url_request_callbacks->push_back(
+      {"AdBlockTP",
+       base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork),
+       HelperThread::kNetworkSequence});
+
+  before_url_request_callbacks->push_back(
+      {"Httpse",
+       base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork),
+       HelperThread::kNetworkSequence});
+
+  before_url_request_callbacks->push_back(
+      {"CommonStaticRedirect",
+       base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork),
+       HelperThread::kNetworkSequence});
 
 #if BUILDFLAG(BRAVE_REWARDS_ENABLED)
-  callback = base::Bind(brave_rewards::OnBeforeURLRequest);
-  before_url_request_callbacks_.push_back(callback);
+  before_url_request_callbacks->push_back(
+      {"Rewards", base::BindRepeating(brave_rewards::OnBeforeURLRequest),
+       HelperThread::kNetworkSequence});
 #endif
 
 #if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_TranslateRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  before_url_request_callbacks->push_back(
+      {"TranslateRedirect",
+       base::BindRepeating(brave::OnBeforeURLRequest_TranslateRedirectWork),
+       HelperThread::kNetworkSequence});
 #endif
 
 #if BUILDFLAG(IPFS_ENABLED)
   if (base::FeatureList::IsEnabled(ipfs::features::kIpfsFeature)) {
-    callback = base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork);
-    before_url_request_callbacks_.push_back(callback);
+    // Reads the profile's IPFS prefs.
+    before_url_request_callbacks->push_back(
+        {"IPFSRedirect",
+         base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork),
+         HelperThread::kUI});
     brave::OnHeadersReceivedCallback ipfs_headers_received_callback =
         base::Bind(ipfs::OnHeadersReceived_IPFSRedirectWork);
     headers_received_callbacks_.push_back(ipfs_headers_received_callback);
@@ -122,6 +143,8 @@ void BraveRequestHandler::SetupCallbacks() {
       base::Bind(webtorrent::OnHeadersReceived_TorrentRedirectWork);
   headers_received_callbacks_.push_back(headers_received_callback);
 #endif
+
+  before_url_request_callbacks_ = std::move(before_url_request_callbacks);
 }
 
 void BraveRequestHandler::InitPrefChangeRegistrar() {
@@ -156,11 +179,14 @@ int BraveRequestHandler::OnBeforeURLRequest(
     std::shared_ptr<brave::BraveRequestInfo> ctx,
     net::CompletionOnceCallback callback,
     GURL* new_url) {
-  if (before_url_request_callbacks_.empty() || IsInternalScheme(ctx)) {
+  if (before_url_request_callbacks_->empty() || IsInternalScheme(ctx)) {
     return net::OK;
   }
-  SCOPED_UMA_HISTOGRAM_TIMER("Brave.OnBeforeURLRequest_Handler");
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("net", "BraveRequestHandler",
+                                    TRACE_ID_LOCAL(ctx->request_identifier),
+                                    "event", "OnBeforeURLRequest");
   ctx->new_url = new_url;
+  ctx->before_url_request_start_time = base::TimeTicks::Now();
   ctx->event_type = brave::kOnBeforeRequest;
   callbacks_[ctx->request_identifier] = std::move(callback);
   RunNextCallback(ctx);
@@ -174,6 +200,9 @@ int BraveRequestHandler::OnBeforeStartTransaction(
   if (before_start_transaction_callbacks_.empty() || IsInternalScheme(ctx)) {
     return net::OK;
   }
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("net", "BraveRequestHandler",
+                                    TRACE_ID_LOCAL(ctx->request_identifier),
+                                    "event", "OnBeforeStartTransaction");
   ctx->event_type = brave::kOnBeforeStartTransaction;
   ctx->headers = headers;
   ctx->referral_headers_list = referral_headers_list_.get();
@@ -200,6 +229,9 @@ int BraveRequestHandler::OnHeadersReceived(
     return net::OK;
   }
 
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("net", "BraveRequestHandler",
+                                    TRACE_ID_LOCAL(ctx->request_identifier),
+                                    "event", "OnHeadersReceived");
   callbacks_[ctx->request_identifier] = std::move(callback);
   ctx->event_type = brave::kOnHeadersReceived;
   ctx->original_response_headers = original_response_headers;
@@ -213,6 +245,8 @@ int BraveRequestHandler::OnHeadersReceived(
 void BraveRequestHandler::OnURLRequestDestroyed(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
   if (base::Contains(callbacks_, ctx->request_identifier)) {
+    TRACE_EVENT_NESTABLE_ASYNC_END0("net", "BraveRequestHandler",
+                                    TRACE_ID_LOCAL(ctx->request_identifier));
     callbacks_.erase(ctx->request_identifier);
   }
 }
@@ -220,6 +254,8 @@ void BraveRequestHandler::OnURLRequestDestroyed(
 void BraveRequestHandler::RunCallbackForRequestIdentifier(
     uint64_t request_identifier,
     int rv) {
+  TRACE_EVENT_NESTABLE_ASYNC_END1("net", "BraveRequestHandler",
+                                  TRACE_ID_LOCAL(request_identifier), "rv", rv);
   std::map<uint64_t, net::CompletionOnceCallback>::iterator it =
       callbacks_.find(request_identifier);
   // We intentionally do the async call to maintain the proper flow
@@ -242,14 +278,30 @@ void BraveRequestHandler::RunNextCallback(
   int rv = net::OK;
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
-    while (before_url_request_callbacks_.size() !=
+    while (before_url_request_callbacks_->size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
-          before_url_request_callbacks_[ctx->next_url_request_index++];
+      const BeforeURLRequestHelper& helper =
+          (*before_url_request_callbacks_)[ctx->next_url_request_index];
+      if (helper.thread == HelperThread::kNetworkSequence) {
+        TRACE_EVENT_NESTABLE_ASYNC_INSTANT1(
+            "net", "BraveRequestHandler::ThreadHop",
+            TRACE_ID_LOCAL(ctx->request_identifier), "to", "network");
+        network_task_runner_->PostTask(
+            FROM_HERE,
+            base::BindOnce(&BraveRequestHandler::RunNetworkSequenceCallbacks,
+                           network_task_runner_, before_url_request_callbacks_,
+                           weak_factory_.GetWeakPtr(), ctx));
+        return;
+      }
+      ctx->next_url_request_index++;
       brave::ResponseCallback next_callback =
           base::Bind(&BraveRequestHandler::RunNextCallback,
                      weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(next_callback, ctx);
+      {
+        TRACE_EVENT1("net", "BraveRequestHandler::RunHelper", "helper",
+                     helper.name);
+        rv = helper.callback.Run(next_callback, ctx);
+      }
       if (rv == net::ERR_IO_PENDING) {
         return;
       }
@@ -292,6 +344,14 @@ void BraveRequestHandler::RunNextCallback(
     }
   }
 
+  // The helpers may hop threads, so the chain is timed up to here rather
+  // than around OnBeforeURLRequest.
+  if (ctx->event_type == brave::kOnBeforeRequest) {
+    UMA_HISTOGRAM_TIMES(
+        "Brave.OnBeforeURLRequest_Handler",
+        base::TimeTicks::Now() - ctx->before_url_request_start_time);
+  }
+
   if (rv != net::OK) {
     RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
     return;
@@ -314,3 +374,74 @@ void BraveRequestHandler::RunNextCallback(
   }
   RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
 }
+
+// static
+void BraveRequestHandler::RunNetworkSequenceCallbacks(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    std::shared_ptr<const BeforeURLRequestHelpers> helpers,
+    base::WeakPtr<BraveRequestHandler> handler,
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  // Async helpers may finish on another sequence (e.g. adblock after a CNAME
+  // lookup on the UI thread).
+  if (!task_runner->RunsTasksInCurrentSequence()) {
+    TRACE_EVENT_NESTABLE_ASYNC_INSTANT1(
+        "net", "BraveRequestHandler::ThreadHop",
+        TRACE_ID_LOCAL(ctx->request_identifier), "to", "network");
+    task_runner->PostTask(
+        FROM_HERE,
+        base::BindOnce(&BraveRequestHandler::RunNetworkSequenceCallbacks,
+                       task_runner, helpers, handler, ctx));
+    return;
+  }
+
+  int rv = net::OK;
+  while (helpers->size() != ctx->next_url_request_index) {
+    const BeforeURLRequestHelper& helper =
+        (*helpers)[ctx->next_url_request_index];
+    if (helper.thread != HelperThread::kNetworkSequence) {
+      break;
+    }
+    ctx->next_url_request_index++;
+    brave::ResponseCallback next_callback =
+        base::BindRepeating(&BraveRequestHandler::RunNetworkSequenceCallbacks,
+                            task_runner, helpers, handler, ctx);
+    {
+      TRACE_EVENT1("net", "BraveRequestHandler::RunHelper", "helper",
+                   helper.name);
+      rv = helper.callback.Run(next_callback, ctx);
+    }
+    if (rv == net::ERR_IO_PENDING) {
+      return;
+    }
+    if (rv != net::OK) {
+      break;
+    }
+  }
+
+  TRACE_EVENT_NESTABLE_ASYNC_INSTANT1(
+      "net", "BraveRequestHandler::ThreadHop",
+      TRACE_ID_LOCAL(ctx->request_identifier), "to", "ui");
+  base::PostTask(
+      FROM_HERE, {content::BrowserThread::UI},
+      base::BindOnce(&BraveRequestHandler::OnNetworkSequenceCallbacksDone,
+                     handler, ctx, rv));
+}
+
+void BraveRequestHandler::OnNetworkSequenceCallbacksDone(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    int rv) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (rv == net::OK) {
+    // Either the chain is done or the next helper needs the UI thread.
+    RunNextCallback(ctx);
+    return;
+  }
+
+  if (!base::Contains(callbacks_, ctx->request_identifier)) {
+    return;
+  }
+  UMA_HISTOGRAM_TIMES(
+      "Brave.OnBeforeURLRequest_Handler",
+      base::TimeTicks::Now() - ctx->before_url_request_start_time);
+  RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+}
@@ -11,10 +11,16 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/browser/net/url_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/completion_once_callback.h"
 
+namespace base {
+class SequencedTaskRunner;
+}  // namespace base
+
 class PrefChangeRegistrar;
 
 // Contains different network stack hooks (similar to capabilities of WebRequest
@@ -46,6 +52,26 @@ class BraveRequestHandler {
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
  private:
+  // Where an OnBeforeURLRequest helper runs. Helpers that only work on the
+  // request info run on |network_task_runner_|; helpers that reach UI-only
+  // objects (profile prefs, WebContents) stay on the UI thread.
+  enum class HelperThread { kUI, kNetworkSequence };
+
+  struct BeforeURLRequestHelper {
+    const char* name;
+    brave::OnBeforeURLRequestCallback callback;
+    HelperThread thread;
+  };
+  using BeforeURLRequestHelpers = std::vector<BeforeURLRequestHelper>;
+
+  // Runs the network sequence helpers starting at the request's next index,
+  // then hands the request back to the UI thread.
+  static void RunNetworkSequenceCallbacks(
+      scoped_refptr<base::SequencedTaskRunner> task_runner,
+      std::shared_ptr<const BeforeURLRequestHelpers> helpers,
+      base::WeakPtr<BraveRequestHandler> handler,
+      std::shared_ptr<brave::BraveRequestInfo> ctx);
+
   void SetupCallbacks();
   void InitPrefChangeRegistrar();
   void OnReferralHeadersChanged();
@@ -53,8 +79,12 @@ class BraveRequestHandler {
   void UpdateAdBlockFromPref(const std::string& pref_name);
 
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void OnNetworkSequenceCallbacksDone(
+      std::shared_ptr<brave::BraveRequestInfo> ctx,
+      int rv);
 
-  std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
+  scoped_refptr<base::SequencedTaskRunner> network_task_runner_;
+  std::shared_ptr<const BeforeURLRequestHelpers> before_url_request_callbacks_;
   std::vector<brave::OnBeforeStartTransactionCallback>
       before_start_transaction_callbacks_;
   std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
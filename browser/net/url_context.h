@@ -10,6 +10,7 @@
 #include <set>
 #include <string>
 
+#include "base/time/time.h"
 #include "net/base/network_isolation_key.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
@@ -129,6 +130,8 @@ struct BraveRequestInfo {
   friend class ::BraveRequestHandler;
 
   GURL* new_url = nullptr;
+  // When the OnBeforeURLRequest chain started, for timing the whole chain.
+  base::TimeTicks before_url_request_start_time;
 
   DISALLOW_COPY_AND_ASSIGN(BraveRequestInfo);
 };
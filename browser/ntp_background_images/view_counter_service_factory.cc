@@ -6,6 +6,7 @@
 #include "brave/browser/ntp_background_images/view_counter_service_factory.h"
 
 #include <memory>
+#include <utility>
 
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/browser/profiles/profile_util.h"
@@ -60,15 +61,18 @@ KeyedService* ViewCounterServiceFactory::BuildServiceInstanceFor(
     if (ads_service) {
       is_supported_locale = ads_service->IsSupportedLocale();
     }
-    content::URLDataSource::Add(
-        browser_context,
-        std::make_unique<NTPBackgroundImagesSource>(service));
+    auto source = std::make_unique<NTPBackgroundImagesSource>(service);
+    auto source_weak_ptr = source->AsWeakPtr();
+    content::URLDataSource::Add(browser_context, std::move(source));
 
-    return new ViewCounterService(service,
-                                  ads_service,
-                                  profile->GetPrefs(),
-                                  g_brave_browser_process->local_state(),
-                                  is_supported_locale);
+    auto* view_counter_service =
+        new ViewCounterService(service,
+                               ads_service,
+                               profile->GetPrefs(),
+                               g_brave_browser_process->local_state(),
+                               is_supported_locale);
+    view_counter_service->SetBackgroundImagesSource(source_weak_ptr);
+    return view_counter_service;
   }
 
   return nullptr;
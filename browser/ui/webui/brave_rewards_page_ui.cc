@@ -7,12 +7,17 @@
 
 #include <stdint.h>
 
-#include <utility>
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "base/i18n/time_formatting.h"
 #include "base/memory/weak_ptr.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
 #include "bat/ledger/mojom_structs.h"
@@ -72,6 +77,11 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void GetReconcileStamp(const base::ListValue* args);
   void SaveSetting(const base::ListValue* args);
   void OnPublisherList(ledger::type::PublisherInfoList list);
+  void OnPublisherPage(
+      const uint32_t start,
+      const base::TimeTicks request_time,
+      ledger::type::PublisherInfoList list,
+      const uint32_t total);
   void OnExcludedSiteList(ledger::type::PublisherInfoList list);
   void ExcludePublisher(const base::ListValue* args);
   void RestorePublishers(const base::ListValue* args);
@@ -81,6 +91,7 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void GetRecurringTips(const base::ListValue* args);
   void GetOneTimeTips(const base::ListValue* args);
   void GetContributionList(const base::ListValue* args);
+  void LoadContributionList(const uint32_t start, const uint32_t limit);
   void GetAdsData(const base::ListValue* args);
   void GetAdsHistory(const base::ListValue* args);
   void OnGetAdsHistory(const base::ListValue& history);
@@ -115,6 +126,9 @@ class RewardsDOMHandler : public WebUIMessageHandler,
       ledger::type::AutoContributePropertiesPtr properties);
   void OnGetReconcileStamp(uint64_t reconcile_stamp);
   void OnAutoContributePropsReady(
+      const uint32_t start,
+      const uint32_t limit,
+      const base::TimeTicks request_time,
       ledger::type::AutoContributePropertiesPtr properties);
   void GetPendingContributionsTotal(const base::ListValue* args);
   void OnGetPendingContributionsTotal(double amount);
@@ -298,6 +312,13 @@ class RewardsDOMHandler : public WebUIMessageHandler,
 
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
   brave_ads::AdsService* ads_service_;  // NOT OWNED
+
+  // Auto-contribute publishers sent to the page when it loads the list in
+  // pages, so that only changed rows are sent after the list is normalized.
+  std::map<std::string, base::Value> contribute_list_rows_;
+  uint32_t contribute_list_total_ = 0;
+  bool contribute_list_paged_ = false;
+
   base::WeakPtrFactory<RewardsDOMHandler> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RewardsDOMHandler);
@@ -313,6 +334,49 @@ const char kAdsSubdivisionTargeting[] = "adsSubdivisionTargeting";
 const char kAutoDetectedAdsSubdivisionTargeting[] =
     "automaticallyDetectedAdsSubdivisionTargeting";
 
+base::Value GetContributePublisherValue(
+    const ledger::type::PublisherInfo& info) {
+  base::Value publisher(base::Value::Type::DICTIONARY);
+  publisher.SetStringKey("id", info.id);
+  publisher.SetDoubleKey("percentage", info.percent);
+  publisher.SetStringKey("publisherKey", info.id);
+  publisher.SetIntKey("status", static_cast<int>(info.status));
+  publisher.SetIntKey("excluded", static_cast<int>(info.excluded));
+  publisher.SetStringKey("name", info.name);
+  publisher.SetStringKey("provider", info.provider);
+  publisher.SetStringKey("url", info.url);
+  publisher.SetStringKey("favIcon", info.favicon_url);
+  return publisher;
+}
+
+// Returns the ids of the first |count| publishers of |list| in the order the
+// page loads them, i.e. by percent and then id.
+std::set<std::string> GetContributeListWindow(
+    const ledger::type::PublisherInfoList& list,
+    const size_t count) {
+  std::vector<const ledger::type::PublisherInfo*> publishers;
+  for (const auto& item : list) {
+    publishers.push_back(item.get());
+  }
+
+  const size_t size = std::min(count, publishers.size());
+  std::partial_sort(publishers.begin(), publishers.begin() + size,
+                    publishers.end(),
+                    [](const ledger::type::PublisherInfo* a,
+                       const ledger::type::PublisherInfo* b) {
+                      if (a->percent != b->percent) {
+                        return a->percent > b->percent;
+                      }
+                      return a->id < b->id;
+                    });
+
+  std::set<std::string> ids;
+  for (size_t i = 0; i < size; i++) {
+    ids.insert(publishers[i]->id);
+  }
+  return ids;
+}
+
 }  // namespace
 
 RewardsDOMHandler::RewardsDOMHandler() : weak_factory_(this) {}
@@ -760,6 +824,9 @@ void RewardsDOMHandler::GetReconcileStamp(const base::ListValue* args) {
 }
 
 void RewardsDOMHandler::OnAutoContributePropsReady(
+    const uint32_t start,
+    const uint32_t limit,
+    const base::TimeTicks request_time,
     ledger::type::AutoContributePropertiesPtr properties) {
   auto filter = ledger::type::ActivityInfoFilter::New();
   auto pair = ledger::type::ActivityInfoFilterOrderPair::New(
@@ -773,12 +840,24 @@ void RewardsDOMHandler::OnAutoContributePropsReady(
   filter->non_verified = properties->contribution_non_verified;
   filter->min_visits = properties->contribution_min_visits;
 
-  rewards_service_->GetActivityInfoList(
-      0,
-      0,
+  if (limit == 0) {
+    rewards_service_->GetActivityInfoList(
+        0,
+        0,
+        std::move(filter),
+        base::Bind(&RewardsDOMHandler::OnPublisherList,
+                   weak_factory_.GetWeakPtr()));
+    return;
+  }
+
+  rewards_service_->GetActivityInfoPage(
+      start,
+      limit,
       std::move(filter),
-      base::Bind(&RewardsDOMHandler::OnPublisherList,
-                 weak_factory_.GetWeakPtr()));
+      base::BindOnce(&RewardsDOMHandler::OnPublisherPage,
+                     weak_factory_.GetWeakPtr(),
+                     start,
+                     request_time));
 }
 
 void RewardsDOMHandler::GetExcludedSites(const base::ListValue* args) {
@@ -911,24 +990,49 @@ void RewardsDOMHandler::OnPublisherList(ledger::type::PublisherInfoList list) {
     return;
   }
 
-  auto publishers = std::make_unique<base::ListValue>();
+  base::Value publishers(base::Value::Type::LIST);
   for (auto const& item : list) {
-    auto publisher = std::make_unique<base::DictionaryValue>();
-    publisher->SetString("id", item->id);
-    publisher->SetDouble("percentage", item->percent);
-    publisher->SetString("publisherKey", item->id);
-    publisher->SetInteger("status", static_cast<int>(item->status));
-    publisher->SetInteger("excluded", static_cast<int>(item->excluded));
-    publisher->SetString("name", item->name);
-    publisher->SetString("provider", item->provider);
-    publisher->SetString("url", item->url);
-    publisher->SetString("favIcon", item->favicon_url);
-    publishers->Append(std::move(publisher));
+    publishers.Append(GetContributePublisherValue(*item));
   }
 
   web_ui()->CallJavascriptFunctionUnsafe(
       "brave_rewards.contributeList",
-      *publishers);
+      std::move(publishers));
+}
+
+void RewardsDOMHandler::OnPublisherPage(
+    const uint32_t start,
+    const base::TimeTicks request_time,
+    ledger::type::PublisherInfoList list,
+    const uint32_t total) {
+  if (!web_ui()->CanCallJavascript()) {
+    return;
+  }
+
+  if (start == 0) {
+    contribute_list_rows_.clear();
+  }
+  contribute_list_paged_ = true;
+  contribute_list_total_ = total;
+
+  base::Value publishers(base::Value::Type::LIST);
+  for (auto const& item : list) {
+    base::Value publisher = GetContributePublisherValue(*item);
+    contribute_list_rows_[item->id] = publisher.Clone();
+    publishers.Append(std::move(publisher));
+  }
+
+  base::Value page(base::Value::Type::DICTIONARY);
+  page.SetIntKey("start", start);
+  page.SetIntKey("total", total);
+  page.SetKey("list", std::move(publishers));
+
+  web_ui()->CallJavascriptFunctionUnsafe(
+      "brave_rewards.contributeListPage",
+      std::move(page));
+
+  UMA_HISTOGRAM_TIMES("Brave.Rewards.ContributeListPageTime",
+                      base::TimeTicks::Now() - request_time);
 }
 
 void RewardsDOMHandler::OnExcludedSiteList(
@@ -1070,9 +1174,25 @@ void RewardsDOMHandler::GetContributionList(const base::ListValue *args) {
     return;
   }
 
+  // Without a window the whole list is sent at once
+  uint32_t start = 0;
+  uint32_t limit = 0;
+  if (args->GetSize() == 2) {
+    start = args->GetList()[0].GetInt();
+    limit = args->GetList()[1].GetInt();
+  }
+
+  LoadContributionList(start, limit);
+}
+
+void RewardsDOMHandler::LoadContributionList(const uint32_t start,
+                                             const uint32_t limit) {
   rewards_service_->GetAutoContributeProperties(
       base::Bind(&RewardsDOMHandler::OnAutoContributePropsReady,
-        weak_factory_.GetWeakPtr()));
+        weak_factory_.GetWeakPtr(),
+        start,
+        limit,
+        base::TimeTicks::Now()));
 }
 
 void RewardsDOMHandler::GetAdsData(const base::ListValue *args) {
@@ -1370,7 +1490,84 @@ void RewardsDOMHandler::OnPendingContributionSaved(
 void RewardsDOMHandler::OnPublisherListNormalized(
     brave_rewards::RewardsService* rewards_service,
     ledger::type::PublisherInfoList list) {
-  OnPublisherList(std::move(list));
+  if (!contribute_list_paged_) {
+    OnPublisherList(std::move(list));
+    return;
+  }
+
+  if (!web_ui()->CanCallJavascript()) {
+    return;
+  }
+
+  const size_t loaded = contribute_list_rows_.size();
+  const bool has_all_publishers = loaded >= contribute_list_total_;
+
+  // If only part of the list is loaded and other publishers now belong in
+  // it, the page reloads the same number of rows from the start
+  if (!has_all_publishers) {
+    const std::set<std::string> window = GetContributeListWindow(list, loaded);
+    const bool window_changed =
+        window.size() != loaded ||
+        std::any_of(window.begin(), window.end(), [this](const auto& id) {
+          return contribute_list_rows_.find(id) == contribute_list_rows_.end();
+        });
+    if (window_changed) {
+      LoadContributionList(0, loaded);
+      return;
+    }
+  }
+
+  // Publishers outside of the loaded part of the list are not sent, they are
+  // loaded with the page they belong to
+  base::Value changed(base::Value::Type::LIST);
+  std::set<std::string> ids;
+  for (const auto& item : list) {
+    ids.insert(item->id);
+
+    base::Value publisher = GetContributePublisherValue(*item);
+    auto iter = contribute_list_rows_.find(item->id);
+    if (iter == contribute_list_rows_.end()) {
+      if (!has_all_publishers) {
+        continue;
+      }
+
+      contribute_list_rows_[item->id] = publisher.Clone();
+    } else if (iter->second == publisher) {
+      continue;
+    } else {
+      iter->second = publisher.Clone();
+    }
+
+    changed.Append(std::move(publisher));
+  }
+
+  base::Value removed(base::Value::Type::LIST);
+  for (auto iter = contribute_list_rows_.begin();
+       iter != contribute_list_rows_.end();) {
+    if (ids.find(iter->first) != ids.end()) {
+      ++iter;
+      continue;
+    }
+
+    removed.Append(base::Value(iter->first));
+    iter = contribute_list_rows_.erase(iter);
+  }
+
+  const uint32_t total = list.size();
+  if (changed.GetList().empty() && removed.GetList().empty() &&
+      total == contribute_list_total_) {
+    return;
+  }
+  contribute_list_total_ = total;
+
+  base::Value delta(base::Value::Type::DICTIONARY);
+  delta.SetIntKey("total", total);
+  delta.SetKey("changed", std::move(changed));
+  delta.SetKey("removed", std::move(removed));
+
+  web_ui()->CallJavascriptFunctionUnsafe(
+      "brave_rewards.contributeListChanged",
+      std::move(delta));
 }
 
 void RewardsDOMHandler::GetStatement(
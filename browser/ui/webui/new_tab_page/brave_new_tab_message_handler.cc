@@ -11,6 +11,7 @@
 #include "base/guid.h"
 #include "base/json/json_writer.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "brave/browser/ntp_background_images/view_counter_service_factory.h"
 #include "brave/browser/profiles/profile_util.h"
@@ -27,6 +28,8 @@
 #include "brave/components/ntp_background_images/common/pref_names.h"
 #include "brave/components/p3a/brave_p3a_utils.h"
 #include "brave/components/weekly_storage/weekly_storage.h"
+#include "brave/components/weekly_storage/weekly_storage_registry.h"
+#include "brave/components/weekly_storage/weekly_storage_registry_factory.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/common/chrome_features.h"
@@ -55,6 +58,12 @@ using ntp_background_images::ViewCounterServiceFactory;
 
 namespace {
 
+WeeklyStorage* GetWeeklyStorage(Profile* profile, const char* pref_name) {
+  return WeeklyStorageRegistryFactory::GetForBrowserContext(
+             profile->GetOriginalProfile())
+      ->Get(pref_name);
+}
+
 bool IsPrivateNewTab(Profile* profile) {
   return profile->IsIncognitoProfile() || profile->IsGuestSession();
 }
@@ -261,6 +270,11 @@ void BraveNewTabMessageHandler::RegisterMessages() {
       base::BindRepeating(
           &BraveNewTabMessageHandler::HandleGetBrandedWallpaperData,
           base::Unretained(this)));
+  web_ui()->RegisterMessageCallback(
+      "brandedWallpaperPainted",
+      base::BindRepeating(
+          &BraveNewTabMessageHandler::HandleBrandedWallpaperPainted,
+          base::Unretained(this)));
   web_ui()->RegisterMessageCallback(
       "customizeClicked",
       base::BindRepeating(&BraveNewTabMessageHandler::HandleCustomizeClicked,
@@ -534,11 +548,38 @@ void BraveNewTabMessageHandler::HandleGetBrandedWallpaperData(
     const std::string wallpaper_id = base::GenerateGUID();
     data.SetStringKey(ntp_background_images::kWallpaperIDKey, wallpaper_id);
     service->BrandedWallpaperWillBeDisplayed(wallpaper_id);
+    branded_wallpaper_cached_ = service->IsCurrentWallpaperCached();
   }
 
   ResolveJavascriptCallback(args->GetList()[0], std::move(data));
 }
 
+void BraveNewTabMessageHandler::HandleBrandedWallpaperPainted(
+    const base::ListValue* args) {
+  AllowJavascript();
+  if (args->GetSize() != 1 ||
+      (!args->GetList()[0].is_double() && !args->GetList()[0].is_int())) {
+    LOG(ERROR) << "Invalid input";
+    return;
+  }
+
+  if (!branded_wallpaper_cached_)
+    return;
+
+  // Time from the start of the New Tab Page navigation until the frame that
+  // shows the wallpaper.
+  const base::TimeDelta paint_time =
+      base::TimeDelta::FromMillisecondsD(args->GetList()[0].GetDouble());
+  if (*branded_wallpaper_cached_) {
+    UMA_HISTOGRAM_TIMES("Brave.NTP.BrandedWallpaperPaintTime.Cached",
+                        paint_time);
+  } else {
+    UMA_HISTOGRAM_TIMES("Brave.NTP.BrandedWallpaperPaintTime.Uncached",
+                        paint_time);
+  }
+  branded_wallpaper_cached_.reset();
+}
+
 void BraveNewTabMessageHandler::HandleCustomizeClicked(
     const base::ListValue* args) {
   AllowJavascript();
@@ -554,10 +595,12 @@ void BraveNewTabMessageHandler::HandleTodayInteractionBegin(
   UMA_HISTOGRAM_EXACT_LINEAR("Brave.Today.HasEverInteracted", 1, 1);
   // Track how many times in the past week
   // user has scrolled to Brave Today.
-  WeeklyStorage session_count_storage(
-      profile_->GetPrefs(), kBraveTodayWeeklySessionCount);
-  session_count_storage.AddDelta(1);
-  uint64_t total_session_count = session_count_storage.GetWeeklySum();
+  WeeklyStorage* session_count_storage =
+      GetWeeklyStorage(profile_, kBraveTodayWeeklySessionCount);
+  if (!session_count_storage)
+    return;
+  session_count_storage->AddDelta(1);
+  uint64_t total_session_count = session_count_storage->GetWeeklySum();
   constexpr int kSessionCountBuckets[] = {0, 1, 3, 7, 12, 18, 25, 1000};
   const int* it_count =
       std::lower_bound(kSessionCountBuckets, std::end(kSessionCountBuckets),
@@ -577,11 +620,13 @@ void BraveNewTabMessageHandler::HandleTodayOnCardVisit(
   int cards_visited_total = args->GetList()[0].GetInt();
   // Track how many Brave Today cards have been viewed per session
   // (each NTP / NTP Message Handler is treated as 1 session).
-  WeeklyStorage storage(
-      profile_->GetPrefs(), kBraveTodayWeeklyCardVisitsCount);
-  storage.ReplaceTodaysValueIfGreater(cards_visited_total);
+  WeeklyStorage* storage =
+      GetWeeklyStorage(profile_, kBraveTodayWeeklyCardVisitsCount);
+  if (!storage)
+    return;
+  storage->ReplaceTodaysValueIfGreater(cards_visited_total);
   // Send the session with the highest count of cards viewed.
-  uint64_t total = storage.GetHighestValueInWeek();
+  uint64_t total = storage->GetHighestValueInWeek();
   constexpr int kBuckets[] = {0, 1, 3, 6, 10, 15, 100};
   const int* it_count =
       std::lower_bound(kBuckets, std::end(kBuckets),
@@ -610,11 +655,13 @@ void BraveNewTabMessageHandler::HandleTodayOnCardViews(
   int cards_viewed_total = args->GetList()[0].GetInt();
   // Track how many Brave Today cards have been viewed per session
   // (each NTP / NTP Message Handler is treated as 1 session).
-  WeeklyStorage storage(
-      profile_->GetPrefs(), kBraveTodayWeeklyCardViewsCount);
-  storage.ReplaceTodaysValueIfGreater(cards_viewed_total);
+  WeeklyStorage* storage =
+      GetWeeklyStorage(profile_, kBraveTodayWeeklyCardViewsCount);
+  if (!storage)
+    return;
+  storage->ReplaceTodaysValueIfGreater(cards_viewed_total);
   // Send the session with the highest count of cards viewed.
-  uint64_t total = storage.GetHighestValueInWeek();
+  uint64_t total = storage->GetHighestValueInWeek();
   constexpr int kBuckets[] = {0, 1, 4, 12, 20, 40, 80, 1000};
   const int* it_count =
       std::lower_bound(kBuckets, std::end(kBuckets),
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "base/optional.h"
 #include "brave/components/tor/buildflags/buildflags.h"
 #include "brave/components/tor/tor_launcher_observer.h"
 #include "components/prefs/pref_change_registrar.h"
@@ -54,6 +55,7 @@ class BraveNewTabMessageHandler : public content::WebUIMessageHandler,
   void HandleRegisterNewTabPageView(const base::ListValue* args);
   void HandleBrandedWallpaperLogoClicked(const base::ListValue* args);
   void HandleGetBrandedWallpaperData(const base::ListValue* args);
+  void HandleBrandedWallpaperPainted(const base::ListValue* args);
   void HandleCustomizeClicked(const base::ListValue* args);
   // TODO(petemill): Today should get it's own message handler
   // or service.
@@ -73,6 +75,9 @@ class BraveNewTabMessageHandler : public content::WebUIMessageHandler,
   PrefChangeRegistrar pref_change_registrar_;
   // Weak pointer.
   Profile* profile_;
+  // Whether the branded wallpaper handed to this page was already in memory.
+  // Reset once its paint time has been recorded.
+  base::Optional<bool> branded_wallpaper_cached_;
 #if BUILDFLAG(ENABLE_TOR)
   TorLauncherFactory* tor_launcher_factory_ = nullptr;
 #endif
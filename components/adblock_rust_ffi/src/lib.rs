@@ -7,6 +7,13 @@ use std::ffi::CString;
 use std::os::raw::c_char;
 use std::string::String;
 
+// Matching, tag checks and cosmetic queries only read the engine, so one
+// engine is shared by every thread matching against it.
+const _: fn() = || {
+    fn assert_sync<T: Sync>() {}
+    assert_sync::<Engine>();
+};
+
 /// An external callback that receives a hostname and two out-parameters for start and end
 /// position. The callback should fill the start and end positions with the start and end indices
 /// of the domain part of the hostname.
@@ -74,7 +81,7 @@ pub unsafe extern "C" fn engine_match(
     let tab_host = CStr::from_ptr(tab_host).to_str().unwrap();
     let resource_type = CStr::from_ptr(resource_type).to_str().unwrap();
     assert!(!engine.is_null());
-    let engine = Box::leak(Box::from_raw(engine));
+    let engine = &*engine;
     let blocker_result = engine.check_network_urls_with_hostnames_subset(
         url,
         host,
@@ -112,7 +119,7 @@ pub unsafe extern "C" fn engine_add_tag(engine: *mut Engine, tag: *const c_char)
 pub unsafe extern "C" fn engine_tag_exists(engine: *mut Engine, tag: *const c_char) -> bool {
     let tag = CStr::from_ptr(tag).to_str().unwrap();
     assert!(!engine.is_null());
-    let engine = Box::leak(Box::from_raw(engine));
+    let engine = &*engine;
     engine.tag_exists(tag)
 }
 
@@ -201,7 +208,7 @@ pub unsafe extern "C" fn engine_url_cosmetic_resources(
 ) -> *mut c_char {
     let url = CStr::from_ptr(url).to_str().unwrap();
     assert!(!engine.is_null());
-    let engine = Box::leak(Box::from_raw(engine));
+    let engine = &*engine;
     let ptr = CString::new(serde_json::to_string(&engine.url_cosmetic_resources(url))
         .unwrap_or_else(|_| "".into()))
         .expect("Error: CString::new()")
@@ -236,7 +243,7 @@ pub unsafe extern "C" fn engine_hidden_class_id_selectors(
         .map(|index| CStr::from_ptr(exceptions[index]).to_str().unwrap().to_owned())
         .collect();
     assert!(!engine.is_null());
-    let engine = Box::leak(Box::from_raw(engine));
+    let engine = &*engine;
     let stylesheet = engine.hidden_class_id_selectors(&classes, &ids, &exceptions);
     CString::new(serde_json::to_string(&stylesheet).unwrap_or_else(|_| "".into())).expect("Error: CString::new()").into_raw()
 }
@@ -8,11 +8,13 @@
 #include <limits>
 #include <utility>
 
+#include "base/auto_reset.h"
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/command_line.h"
 #include "base/containers/flat_map.h"
 #include "base/feature_list.h"
+#include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/files/important_file_writer.h"
@@ -26,6 +28,7 @@
 #include "base/path_service.h"
 #include "base/sequenced_task_runner.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
@@ -58,6 +61,7 @@
 #include "brave/components/rpill/common/rpill.h"
 #include "brave/components/services/bat_ads/public/cpp/ads_client_mojo_bridge.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "brave/components/weekly_storage/weekly_storage_registry_factory.h"
 #include "brave/grit/brave_generated_resources.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/notifications/notification_display_service.h"
@@ -104,6 +108,8 @@ namespace {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+const char kAdsPrefPrefix[] = "brave.brave_ads.";
+
 }  // namespace
 
 namespace {
@@ -149,6 +155,10 @@ std::string LoadOnFileTaskRunner(const base::FilePath& path) {
   return data;
 }
 
+base::File OpenOnFileTaskRunner(const base::FilePath& path) {
+  return base::File(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+}
+
 bool EnsureBaseDirectoryExistsOnFileTaskRunner(const base::FilePath& path) {
   if (base::DirectoryExists(path)) {
     return true;
@@ -209,7 +219,7 @@ AdsServiceImpl::AdsServiceImpl(Profile* profile)
       display_service_(NotificationDisplayService::GetForProfile(profile_)),
       rewards_service_(
           brave_rewards::RewardsServiceFactory::GetForProfile(profile_)),
-      bat_ads_client_receiver_(new bat_ads::AdsClientMojoBridge(this)) {
+      bat_ads_client_receiver_(new bat_ads::AdsClientMojoBridge(this, this)) {
   DCHECK(brave::IsRegularProfile(profile_));
 
   MigratePrefs();
@@ -655,10 +665,63 @@ void AdsServiceImpl::OnCreate() {
     return;
   }
 
+  SendAdsPrefs();
+
   auto callback = base::BindOnce(&AdsServiceImpl::OnInitialize, AsWeakPtr());
   bat_ads_->Initialize(base::BindOnce(std::move(callback)));
 }
 
+void AdsServiceImpl::SendAdsPrefs() {
+  // Ads read prefs through a copy kept in the utility process, seed it with
+  // every ads pref and keep it up to date
+  PrefService* pref_service = profile_->GetPrefs();
+  ads_pref_change_registrar_.RemoveAll();
+  ads_pref_change_registrar_.Init(pref_service);
+
+  std::vector<std::string> paths;
+  pref_service->IteratePreferenceValues(base::BindRepeating(
+      [](std::vector<std::string>* paths, const std::string& path,
+         const base::Value& value) {
+        if (base::StartsWith(path, kAdsPrefPrefix,
+                             base::CompareCase::SENSITIVE)) {
+          paths->push_back(path);
+        }
+      },
+      &paths));
+
+  base::flat_map<std::string, base::Value> prefs;
+  for (const auto& path : paths) {
+    prefs.emplace(path, pref_service->Get(path)->Clone());
+    ads_pref_change_registrar_.Add(
+        path, base::BindRepeating(&AdsServiceImpl::OnAdsPrefChanged,
+                                  base::Unretained(this)));
+  }
+
+  bat_ads_->OnPrefsChanged(std::move(prefs));
+}
+
+void AdsServiceImpl::OnAdsPrefChanged(const std::string& path) {
+  // Writes made by ads are acknowledged by OnAdsPrefWritten instead
+  if (updating_ads_prefs_ || !connected()) {
+    return;
+  }
+
+  base::flat_map<std::string, base::Value> prefs;
+  prefs.emplace(path, profile_->GetPrefs()->Get(path)->Clone());
+  bat_ads_->OnPrefsChanged(std::move(prefs));
+}
+
+void AdsServiceImpl::OnAdsPrefWritten(const std::string& path) {
+  // Ads drop changes to |path| until each of their writes is acknowledged, so
+  // an older change can't overwrite their copy
+  if (!connected()) {
+    return;
+  }
+
+  const base::Value* value = profile_->GetPrefs()->Get(path);
+  bat_ads_->OnPrefWritten(path, value ? value->Clone() : base::Value());
+}
+
 void AdsServiceImpl::OnInitialize(const int32_t result) {
   if (result != ads::Result::SUCCESS) {
     VLOG(0) << "Failed to initialize ads";
@@ -1884,21 +1947,10 @@ void AdsServiceImpl::Save(const std::string& name,
 
 void AdsServiceImpl::LoadUserModelForId(const std::string& id,
                                         ads::LoadCallback callback) {
-  const base::Optional<base::FilePath> path =
-      g_brave_browser_process->user_model_file_service()->GetPathForId(id);
-
-  if (!path) {
-    callback(ads::Result::FAILED, "");
-    return;
-  }
-
-  VLOG(1) << "Loading user model from " << path.value();
-
-  base::PostTaskAndReplyWithResult(
-      file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&LoadOnFileTaskRunner, path.value()),
-      base::BindOnce(&AdsServiceImpl::OnLoaded, AsWeakPtr(),
-                     std::move(callback)));
+  // Only kept for the ads::AdsClient interface, bat_ads opens user models with
+  // OpenUserModelFileForId instead
+  NOTREACHED();
+  callback(ads::Result::FAILED, "");
 }
 
 void AdsServiceImpl::RecordP2AEvent(const std::string& name,
@@ -1916,8 +1968,14 @@ void AdsServiceImpl::RecordP2AEvent(const std::string& name,
         break;
       }
 
+      WeeklyStorageRegistry* registry =
+          WeeklyStorageRegistryFactory::GetForBrowserContext(profile_);
+      if (!registry) {
+        break;
+      }
+
       for (auto& item : *list) {
-        RecordInWeeklyStorageAndEmitP2AHistogramAnswer(profile_->GetPrefs(),
+        RecordInWeeklyStorageAndEmitP2AHistogramAnswer(registry,
                                                        item.GetString());
       }
       break;
@@ -1938,6 +1996,25 @@ std::string AdsServiceImpl::LoadResourceForId(const std::string& id) {
   return LoadDataResourceAndDecompressIfNeeded(resource_id);
 }
 
+void AdsServiceImpl::OpenUserModelFileForId(
+    const std::string& id,
+    OpenUserModelFileForIdCallback callback) {
+  const base::Optional<base::FilePath> path =
+      g_brave_browser_process->user_model_file_service()->GetPathForId(id);
+
+  if (!path) {
+    std::move(callback).Run(base::File());
+    return;
+  }
+
+  VLOG(1) << "Opening user model from " << path.value();
+
+  base::PostTaskAndReplyWithResult(
+      file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&OpenOnFileTaskRunner, path.value()),
+      std::move(callback));
+}
+
 ads::DBCommandResponsePtr RunDBTransactionOnFileTaskRunner(
     ads::DBTransactionPtr transaction,
     ads::Database* database) {
@@ -1999,7 +2076,9 @@ bool AdsServiceImpl::GetBooleanPref(const std::string& path) const {
 }
 
 void AdsServiceImpl::SetBooleanPref(const std::string& path, const bool value) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->SetBoolean(path, value);
+  OnAdsPrefWritten(path);
 }
 
 int AdsServiceImpl::GetIntegerPref(const std::string& path) const {
@@ -2007,7 +2086,9 @@ int AdsServiceImpl::GetIntegerPref(const std::string& path) const {
 }
 
 void AdsServiceImpl::SetIntegerPref(const std::string& path, const int value) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->SetInteger(path, value);
+  OnAdsPrefWritten(path);
 }
 
 double AdsServiceImpl::GetDoublePref(const std::string& path) const {
@@ -2016,7 +2097,9 @@ double AdsServiceImpl::GetDoublePref(const std::string& path) const {
 
 void AdsServiceImpl::SetDoublePref(const std::string& path,
                                    const double value) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->SetDouble(path, value);
+  OnAdsPrefWritten(path);
 }
 
 std::string AdsServiceImpl::GetStringPref(const std::string& path) const {
@@ -2025,7 +2108,9 @@ std::string AdsServiceImpl::GetStringPref(const std::string& path) const {
 
 void AdsServiceImpl::SetStringPref(const std::string& path,
                                    const std::string& value) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->SetString(path, value);
+  OnAdsPrefWritten(path);
 }
 
 int64_t AdsServiceImpl::GetInt64Pref(const std::string& path) const {
@@ -2039,7 +2124,9 @@ int64_t AdsServiceImpl::GetInt64Pref(const std::string& path) const {
 
 void AdsServiceImpl::SetInt64Pref(const std::string& path,
                                   const int64_t value) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->SetInt64(path, value);
+  OnAdsPrefWritten(path);
 }
 
 uint64_t AdsServiceImpl::GetUint64Pref(const std::string& path) const {
@@ -2053,11 +2140,15 @@ uint64_t AdsServiceImpl::GetUint64Pref(const std::string& path) const {
 
 void AdsServiceImpl::SetUint64Pref(const std::string& path,
                                    const uint64_t value) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->SetUint64(path, value);
+  OnAdsPrefWritten(path);
 }
 
 void AdsServiceImpl::ClearPref(const std::string& path) {
+  base::AutoReset<bool> updating(&updating_ads_prefs_, true);
   profile_->GetPrefs()->ClearPref(path);
+  OnAdsPrefWritten(path);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include "brave/components/brave_ads/browser/notification_helper.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service_observer.h"
 #include "brave/components/brave_user_model/browser/user_model_file_service.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_client_mojo_bridge.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "chrome/browser/notifications/notification_handler.h"
 #include "components/history/core/browser/history_service_observer.h"
@@ -65,6 +66,7 @@ class AdsServiceImpl : public AdsService,
                        public history::HistoryServiceObserver,
                        BackgroundHelper::Observer,
                        public brave_user_model::Observer,
+                       public bat_ads::AdsClientMojoBridge::UserModelFileDelegate,
                        public base::SupportsWeakPtr<AdsServiceImpl> {
  public:
   void OnWalletUpdated();
@@ -175,6 +177,10 @@ class AdsServiceImpl : public AdsService,
 
   void OnCreate();
 
+  void SendAdsPrefs();
+  void OnAdsPrefChanged(const std::string& path);
+  void OnAdsPrefWritten(const std::string& path);
+
   void OnInitialize(const int32_t result);
 
   void ShutdownBatAds();
@@ -340,6 +346,11 @@ class AdsServiceImpl : public AdsService,
 
   std::string LoadResourceForId(const std::string& id) override;
 
+  // bat_ads::AdsClientMojoBridge::UserModelFileDelegate implementation
+  void OpenUserModelFileForId(
+      const std::string& id,
+      OpenUserModelFileForIdCallback callback) override;
+
   void RunDBTransaction(ads::DBTransactionPtr transaction,
                         ads::RunDBTransactionCallback callback) override;
 
@@ -417,6 +428,8 @@ class AdsServiceImpl : public AdsService,
   base::RepeatingTimer idle_poll_timer_;
 
   PrefChangeRegistrar profile_pref_change_registrar_;
+  PrefChangeRegistrar ads_pref_change_registrar_;
+  bool updating_ads_prefs_ = false;
 
   base::flat_set<network::SimpleURLLoader*> url_loaders_;
 
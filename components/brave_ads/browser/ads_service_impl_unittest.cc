@@ -43,6 +43,11 @@ class MockRewardsService : public RewardsService {
                     const uint32_t,
                     ledger::type::ActivityInfoFilterPtr,
                     const brave_rewards::GetPublisherInfoListCallback&));
+  MOCK_METHOD4(GetActivityInfoPage,
+               void(const uint32_t,
+                    const uint32_t,
+                    ledger::type::ActivityInfoFilterPtr,
+                    brave_rewards::GetPublisherInfoPageCallback));
   MOCK_METHOD1(GetExcludedList,
                void(const brave_rewards::GetPublisherInfoListCallback&));
   MOCK_METHOD0(FetchPromotions, void());
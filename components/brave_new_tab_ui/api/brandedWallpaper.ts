@@ -14,3 +14,7 @@ export function registerViewCount (): Promise<void> {
 export function brandedWallpaperLogoClicked (data: NewTab.BrandedWallpaper | undefined) {
   chrome.send('brandedWallpaperLogoClicked', [ data ])
 }
+
+export function brandedWallpaperPainted () {
+  chrome.send('brandedWallpaperPainted', [ window.performance.now() ])
+}
@@ -22,7 +22,7 @@ import {
 } from '../../components/default'
 import * as Page from '../../components/default/page'
 import BrandedWallpaperLogo from '../../components/default/brandedWallpaper/logo'
-import { brandedWallpaperLogoClicked } from '../../api/brandedWallpaper'
+import { brandedWallpaperLogoClicked, brandedWallpaperPainted } from '../../api/brandedWallpaper'
 import BraveTodayHint from '../../components/default/braveToday/hint'
 import BraveToday from '../../components/default/braveToday'
 import BAPDeprecationModal from '../../components/default/rewards/bapDeprecationModal'
@@ -113,6 +113,7 @@ class NewTabPage extends React.Component<Props, State> {
     activeSettingsTab: null
   }
   hasInitBraveToday: boolean = false
+  hasReportedBrandedWallpaperPaint: boolean = false
   imageSource?: string = undefined
   timerIdForBrandedWallpaperNotification?: number = undefined
   onVisiblityTimerExpired = () => {
@@ -166,11 +167,21 @@ class NewTabPage extends React.Component<Props, State> {
         console.timeStamp('image loaded')
         this.setState({
           backgroundHasLoaded: true
-        })
+        }, this.reportBrandedWallpaperPaint)
       }
     }
   }
 
+  reportBrandedWallpaperPaint = () => {
+    const wallpaperData = this.props.newTabData.brandedWallpaperData
+    if (this.hasReportedBrandedWallpaperPaint || !wallpaperData ||
+        this.imageSource !== wallpaperData.wallpaperImageUrl) {
+      return
+    }
+    this.hasReportedBrandedWallpaperPaint = true
+    window.requestAnimationFrame(() => brandedWallpaperPainted())
+  }
+
   trackBrandedWallpaperNotificationAutoDismiss () {
     // Wait until page has been visible for an uninterupted Y seconds and then
     // dismiss the notification.
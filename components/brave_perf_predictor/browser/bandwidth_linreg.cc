@@ -9,8 +9,13 @@
 #include <cmath>
 #include <numeric>
 #include <utility>
+#include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -37,6 +42,31 @@ bool StandardiseFeatsNoOutliers(
 
 }  // namespace
 
+base::Optional<unsigned int> ThirdPartyFeatureIndex(
+    const std::string& entity) {
+  static const base::NoDestructor<base::flat_map<std::string, unsigned int>>
+      index_by_entity([] {
+        constexpr base::StringPiece kPrefix = "thirdParties.";
+        constexpr base::StringPiece kSuffix = ".blocked";
+        std::vector<std::pair<std::string, unsigned int>> entries;
+        for (unsigned int i = 0; i < feature_count; i++) {
+          base::StringPiece name = feature_sequence[i];
+          if (!base::StartsWith(name, kPrefix, base::CompareCase::SENSITIVE) ||
+              !base::EndsWith(name, kSuffix, base::CompareCase::SENSITIVE)) {
+            continue;
+          }
+          name.remove_prefix(kPrefix.size());
+          name.remove_suffix(kSuffix.size());
+          entries.emplace_back(name.as_string(), i);
+        }
+        return base::flat_map<std::string, unsigned int>(std::move(entries));
+      }());
+  const auto it = index_by_entity->find(entity);
+  if (it == index_by_entity->end())
+    return base::nullopt;
+  return it->second;
+}
+
 double LinregPredictVector(const std::array<double, feature_count>& features) {
   // Standardise numeric features
   std::array<double, standardise_feat_count> numeric_features;
@@ -65,14 +95,4 @@ double LinregPredictVector(const std::array<double, feature_count>& features) {
   return std::pow(10, log_prediction);
 }
 
-double LinregPredictNamed(const base::flat_map<std::string, double>& features) {
-  std::array<double, feature_count> feature_vector{};
-  for (unsigned int i = 0; i < feature_count; i++) {
-    auto it = features.find(feature_sequence.at(i));
-    if (it != features.end())
-      feature_vector[i] = it->second;
-  }
-  return LinregPredictVector(feature_vector);
-}
-
 }  // namespace brave_perf_predictor
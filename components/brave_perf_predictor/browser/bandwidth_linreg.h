@@ -9,7 +9,7 @@
 #include <string>
 #include <vector>
 
-#include "base/containers/flat_map.h"
+#include "base/optional.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -18,19 +18,40 @@ constexpr double kOutlierThreshold = 6;
 // if above 20MB _and_ more than 6x of the transfer size, probably an outlier
 constexpr double kSavingsAbsoluteOutlier = 20 << 20;
 
+namespace internal {
+
+constexpr bool FeatureNameEquals(const char* a, const char* b) {
+  while (*a != '\0' && *a == *b) {
+    ++a;
+    ++b;
+  }
+  return *a == *b;
+}
+
+}  // namespace internal
+
+// Returns the position of the named feature in the model's feature vector, or
+// |feature_count| if the model doesn't use the feature. Meant to be evaluated
+// at compile time, so that callers can accumulate features directly into a
+// dense vector instead of a string-keyed map.
+constexpr unsigned int FeatureIndex(const char* name) {
+  for (unsigned int i = 0; i < feature_count; i++) {
+    if (internal::FeatureNameEquals(feature_sequence[i], name))
+      return i;
+  }
+  return feature_count;
+}
+
+// Returns the position of the "thirdParties.<entity>.blocked" feature for the
+// given entity name, if the model uses it.
+base::Optional<unsigned int> ThirdPartyFeatureIndex(
+    const std::string& entity);
+
 // Computes prediction based on the provided feature vector.
 // It is the client's responsibility to provide features in
 // the exact order expected by the predictor.
 double LinregPredictVector(const std::array<double, feature_count>& features);
 
-// Computes prediction based on key-value map of features.
-// It translates the map to a feature vector internally, and
-// it is the client's responsibility to ensure that all required
-// features are present and only the necessary features are provided.
-// The function uses 0 for any features not provided and ignores
-// any extra features.
-double LinregPredictNamed(const base::flat_map<std::string, double>& features);
-
 }  // namespace brave_perf_predictor
 
 #endif  // BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_BANDWIDTH_LINREG_H_
@@ -5,11 +5,27 @@
 
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg.h"
 
+#include <string>
+
 #include "base/containers/flat_map.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_perf_predictor {
 
+namespace {
+
+double PredictNamed(const base::flat_map<std::string, double>& features) {
+  std::array<double, feature_count> feature_vector{};
+  for (const auto& feature : features) {
+    const unsigned int index = FeatureIndex(feature.first.c_str());
+    if (index < feature_count)
+      feature_vector[index] = feature.second;
+  }
+  return LinregPredictVector(feature_vector);
+}
+
+}  // namespace
+
 TEST(BraveSavingsPredictorTest, FeatureArrayGetsPrediction) {
   const std::array<double, feature_count> features{};
   double result = LinregPredictVector(features);
@@ -45,7 +61,7 @@ TEST(BraveSavingsPredictorTest, HandlesSpecificVectorExample) {
 
 TEST(BraveSavingsPredictorTest, HandlesEmptyFeatureset) {
   const base::flat_map<std::string, double> features{};
-  const double result = LinregPredictNamed(features);
+  const double result = PredictNamed(features);
   const std::array<double, feature_count> features_array{};
   const double array_result = LinregPredictVector(features_array);
   EXPECT_EQ(result, array_result);
@@ -56,7 +72,7 @@ TEST(BraveSavingsPredictorTest, HandlesCompleteFeatureset) {
   for (unsigned int i = 0; i < feature_count; i++) {
     features[feature_sequence.at(i)] = 0;
   }
-  const double result = LinregPredictNamed(features);
+  const double result = PredictNamed(features);
   const std::array<double, feature_count> array_features{};
   const double array_result = LinregPredictVector(array_features);
   EXPECT_EQ(result, array_result);
@@ -99,9 +115,17 @@ TEST(BraveSavingsPredictorTest, HandesSpecificFeaturemapExample) {
       {"resources.total.requestCount", 59},
       {"resources.total.size", 238413},
   };
-  double result = LinregPredictNamed(featuremap);
+  double result = PredictNamed(featuremap);
   EXPECT_EQ(static_cast<int>(result / 1000),
             794);  // Equal on the order of thousands
 }
 
+TEST(BraveSavingsPredictorTest, ThirdPartyFeatureIndexMatchesFeatureName) {
+  EXPECT_EQ(FeatureIndex("thirdParties.Facebook.blocked"),
+            ThirdPartyFeatureIndex("Facebook"));
+  EXPECT_EQ(FeatureIndex("thirdParties.Tawk.to.blocked"),
+            ThirdPartyFeatureIndex("Tawk.to"));
+  EXPECT_FALSE(ThirdPartyFeatureIndex("Not A Third Party").has_value());
+}
+
 }  // namespace brave_perf_predictor
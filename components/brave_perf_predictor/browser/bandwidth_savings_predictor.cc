@@ -15,6 +15,105 @@
 
 namespace brave_perf_predictor {
 
+namespace {
+
+constexpr unsigned int kAdblockRequests = FeatureIndex("adblockRequests");
+constexpr unsigned int kFirstMeaningfulPaint =
+    FeatureIndex("metrics.firstMeaningfulPaint");
+constexpr unsigned int kObservedDomContentLoaded =
+    FeatureIndex("metrics.observedDomContentLoaded");
+constexpr unsigned int kObservedFirstVisualChange =
+    FeatureIndex("metrics.observedFirstVisualChange");
+constexpr unsigned int kObservedLoad = FeatureIndex("metrics.observedLoad");
+constexpr unsigned int kThirdPartyRequestCount =
+    FeatureIndex("resources.third-party.requestCount");
+constexpr unsigned int kThirdPartySize =
+    FeatureIndex("resources.third-party.size");
+constexpr unsigned int kTotalRequestCount =
+    FeatureIndex("resources.total.requestCount");
+constexpr unsigned int kTotalSize = FeatureIndex("resources.total.size");
+
+struct ResourceTypeFeatures {
+  unsigned int request_count;
+  unsigned int size;
+};
+
+constexpr ResourceTypeFeatures kDocumentFeatures = {
+    FeatureIndex("resources.document.requestCount"),
+    FeatureIndex("resources.document.size")};
+constexpr ResourceTypeFeatures kStylesheetFeatures = {
+    FeatureIndex("resources.stylesheet.requestCount"),
+    FeatureIndex("resources.stylesheet.size")};
+constexpr ResourceTypeFeatures kScriptFeatures = {
+    FeatureIndex("resources.script.requestCount"),
+    FeatureIndex("resources.script.size")};
+constexpr ResourceTypeFeatures kImageFeatures = {
+    FeatureIndex("resources.image.requestCount"),
+    FeatureIndex("resources.image.size")};
+constexpr ResourceTypeFeatures kFontFeatures = {
+    FeatureIndex("resources.font.requestCount"),
+    FeatureIndex("resources.font.size")};
+constexpr ResourceTypeFeatures kMediaFeatures = {
+    FeatureIndex("resources.media.requestCount"),
+    FeatureIndex("resources.media.size")};
+constexpr ResourceTypeFeatures kOtherFeatures = {
+    FeatureIndex("resources.other.requestCount"),
+    FeatureIndex("resources.other.size")};
+
+constexpr bool IsModelFeature(unsigned int index) {
+  return index < feature_count;
+}
+
+constexpr bool AreModelFeatures(const ResourceTypeFeatures& features) {
+  return IsModelFeature(features.request_count) &&
+         IsModelFeature(features.size);
+}
+
+// The generated model parameters must provide every feature collected here.
+static_assert(IsModelFeature(kAdblockRequests) &&
+                  IsModelFeature(kFirstMeaningfulPaint) &&
+                  IsModelFeature(kObservedDomContentLoaded) &&
+                  IsModelFeature(kObservedFirstVisualChange) &&
+                  IsModelFeature(kObservedLoad) &&
+                  IsModelFeature(kThirdPartyRequestCount) &&
+                  IsModelFeature(kThirdPartySize) &&
+                  IsModelFeature(kTotalRequestCount) &&
+                  IsModelFeature(kTotalSize),
+              "Missing model feature");
+static_assert(AreModelFeatures(kDocumentFeatures) &&
+                  AreModelFeatures(kStylesheetFeatures) &&
+                  AreModelFeatures(kScriptFeatures) &&
+                  AreModelFeatures(kImageFeatures) &&
+                  AreModelFeatures(kFontFeatures) &&
+                  AreModelFeatures(kMediaFeatures) &&
+                  AreModelFeatures(kOtherFeatures),
+              "Missing resource type model feature");
+
+const ResourceTypeFeatures& GetResourceTypeFeatures(
+    network::mojom::RequestDestination destination) {
+  switch (destination) {
+    case network::mojom::RequestDestination::kDocument:
+    case network::mojom::RequestDestination::kIframe:
+      return kDocumentFeatures;
+    case network::mojom::RequestDestination::kStyle:
+      return kStylesheetFeatures;
+    case network::mojom::RequestDestination::kScript:
+      return kScriptFeatures;
+    case network::mojom::RequestDestination::kImage:
+      return kImageFeatures;
+    case network::mojom::RequestDestination::kFont:
+      return kFontFeatures;
+    case network::mojom::RequestDestination::kAudio:
+    case network::mojom::RequestDestination::kTrack:
+    case network::mojom::RequestDestination::kVideo:
+      return kMediaFeatures;
+    default:
+      return kOtherFeatures;
+  }
+}
+
+}  // namespace
+
 BandwidthSavingsPredictor::BandwidthSavingsPredictor(
     const NamedThirdPartyRegistry* registry)
     : tp_registry_(registry) {}
@@ -25,34 +124,37 @@ void BandwidthSavingsPredictor::OnPageLoadTimingUpdated(
     const page_load_metrics::mojom::PageLoadTiming& timing) {
   // First meaningful paint
   if (timing.paint_timing->first_meaningful_paint.has_value())
-    feature_map_["metrics.firstMeaningfulPaint"] =
+    features_[kFirstMeaningfulPaint] =
         timing.paint_timing->first_meaningful_paint.value().InMillisecondsF();
 
   // DOM Content Loaded
   if (timing.document_timing->dom_content_loaded_event_start.has_value())
-    feature_map_["metrics.observedDomContentLoaded"] =
+    features_[kObservedDomContentLoaded] =
         timing.document_timing->dom_content_loaded_event_start.value()
             .InMillisecondsF();
 
   // First contentful paint
   if (timing.paint_timing->first_contentful_paint.has_value())
-    feature_map_["metrics.observedFirstVisualChange"] =
+    features_[kObservedFirstVisualChange] =
         timing.paint_timing->first_contentful_paint.value().InMillisecondsF();
 
   // Load
   if (timing.document_timing->load_event_start.has_value())
-    feature_map_["metrics.observedLoad"] =
+    features_[kObservedLoad] =
         timing.document_timing->load_event_start.value().InMillisecondsF();
 }
 
 void BandwidthSavingsPredictor::OnSubresourceBlocked(
     const std::string& resource_url) {
-  feature_map_["adblockRequests"] += 1;
+  features_[kAdblockRequests] += 1;
 
   if (tp_registry_) {
     const auto tp_name = tp_registry_->GetThirdParty(resource_url);
-    if (tp_name.has_value())
-      feature_map_["thirdParties." + tp_name.value() + ".blocked"] = 1;
+    if (tp_name.has_value()) {
+      const auto tp_index = ThirdPartyFeatureIndex(tp_name.value());
+      if (tp_index.has_value())
+        features_[tp_index.value()] = 1;
+    }
   }
 }
 
@@ -73,47 +175,18 @@ void BandwidthSavingsPredictor::OnResourceLoadComplete(
           net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
   if (is_third_party) {
-    feature_map_["resources.third-party.requestCount"] += 1;
-    feature_map_["resources.third-party.size"] +=
-        resource_load_info.raw_body_bytes;
+    features_[kThirdPartyRequestCount] += 1;
+    features_[kThirdPartySize] += resource_load_info.raw_body_bytes;
   }
 
-  feature_map_["resources.total.requestCount"] += 1;
-  feature_map_["resources.total.size"] += resource_load_info.raw_body_bytes;
-  feature_map_["transfer.total.size"] +=
-      resource_load_info.total_received_bytes;
-  std::string resource_type;
-  switch (resource_load_info.request_destination) {
-    case network::mojom::RequestDestination::kDocument:
-      resource_type = "document";
-      break;
-    case network::mojom::RequestDestination::kIframe:
-      resource_type = "document";
-      break;
-    case network::mojom::RequestDestination::kStyle:
-      resource_type = "stylesheet";
-      break;
-    case network::mojom::RequestDestination::kScript:
-      resource_type = "script";
-      break;
-    case network::mojom::RequestDestination::kImage:
-      resource_type = "image";
-      break;
-    case network::mojom::RequestDestination::kFont:
-      resource_type = "font";
-      break;
-    case network::mojom::RequestDestination::kAudio:
-    case network::mojom::RequestDestination::kTrack:
-    case network::mojom::RequestDestination::kVideo:
-      resource_type = "media";
-      break;
-    default:
-      resource_type = "other";
-      break;
-  }
-  feature_map_["resources." + resource_type + ".requestCount"] += 1;
-  feature_map_["resources." + resource_type + ".size"] +=
-      resource_load_info.raw_body_bytes;
+  features_[kTotalRequestCount] += 1;
+  features_[kTotalSize] += resource_load_info.raw_body_bytes;
+  transfer_total_size_ += resource_load_info.total_received_bytes;
+
+  const ResourceTypeFeatures& resource_type =
+      GetResourceTypeFeatures(resource_load_info.request_destination);
+  features_[resource_type.request_count] += 1;
+  features_[resource_type.size] += resource_load_info.raw_body_bytes;
 }
 
 double BandwidthSavingsPredictor::PredictSavingsBytes() const {
@@ -121,37 +194,37 @@ double BandwidthSavingsPredictor::PredictSavingsBytes() const {
       !main_frame_url_.SchemeIsHTTPOrHTTPS()) {
     return 0;
   }
-  const auto total_size = feature_map_.find("transfer.total.size");
-  if (total_size != feature_map_.end() && total_size->second > 0) {
-    VLOG(2) << main_frame_url_ << " total download size " << total_size->second
-            << " bytes";
+  if (transfer_total_size_ > 0) {
+    VLOG(2) << main_frame_url_ << " total download size "
+            << transfer_total_size_ << " bytes";
   } else {
     return 0;
   }
 
   // Short-circuit if nothing got blocked
-  const auto adblock_requests = feature_map_.find("adblockRequests");
-  if (adblock_requests == feature_map_.end() || adblock_requests->second < 1) {
+  if (features_[kAdblockRequests] < 1) {
     return 0;
   }
   if (VLOG_IS_ON(3)) {
-    VLOG(3) << "Predicting on feature map:";
-    for (const auto& feature : feature_map_) {
-      VLOG(3) << feature.first << " :: " << feature.second;
+    VLOG(3) << "Predicting on features:";
+    for (unsigned int i = 0; i < feature_count; i++) {
+      if (features_[i] != 0)
+        VLOG(3) << feature_sequence[i] << " :: " << features_[i];
     }
   }
-  double prediction = ::brave_perf_predictor::LinregPredictNamed(feature_map_);
+  double prediction = ::brave_perf_predictor::LinregPredictVector(features_);
   VLOG(2) << main_frame_url_ << " estimated saving " << prediction << " bytes";
   // Sanity check for predicted saving
   if (prediction > kSavingsAbsoluteOutlier &&
-      (prediction / kOutlierThreshold) > total_size->second) {
+      (prediction / kOutlierThreshold) > transfer_total_size_) {
     return 0;
   }
   return prediction;
 }
 
 void BandwidthSavingsPredictor::Reset() {
-  feature_map_.clear();
+  features_.fill(0);
+  transfer_total_size_ = 0;
   main_frame_url_ = {};
 }
 
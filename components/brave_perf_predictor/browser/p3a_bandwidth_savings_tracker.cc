@@ -47,10 +47,18 @@ P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(
     std::unique_ptr<base::Clock> clock)
     : user_prefs_(user_prefs), clock_(std::move(clock)) {}
 
+P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(
+    WeeklyStorage* weekly_storage)
+    : weekly_storage_(weekly_storage) {}
+
 void P3ABandwidthSavingsTracker::RecordSavings(uint64_t savings) {
-  if (savings > 0 && user_prefs_) {
-    // TODO(AndriusA): optimise if needed, loading permanent state on every
-    // record could be costly
+  if (savings == 0)
+    return;
+
+  if (weekly_storage_) {
+    weekly_storage_->AddDelta(savings);
+    StoreSavingsHistogram(weekly_storage_->GetWeeklySum());
+  } else if (user_prefs_) {
     WeeklyStorage weekly(user_prefs_, prefs::kBandwidthSavedDailyBytes);
     weekly.AddDelta(savings);
     StoreSavingsHistogram(weekly.GetWeeklySum());
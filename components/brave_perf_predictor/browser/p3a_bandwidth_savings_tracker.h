@@ -11,6 +11,7 @@
 
 class PrefRegistrySimple;
 class PrefService;
+class WeeklyStorage;
 
 namespace base {
 class Clock;
@@ -24,6 +25,10 @@ class P3ABandwidthSavingsTracker {
   // Constructor with injected clock for testing
   P3ABandwidthSavingsTracker(PrefService* user_prefs,
                              std::unique_ptr<base::Clock> clock);
+  // Records into a long-lived storage (owned by a WeeklyStorageRegistry)
+  // instead of reloading the pref on every record. |weekly_storage| must
+  // outlive the tracker.
+  explicit P3ABandwidthSavingsTracker(WeeklyStorage* weekly_storage);
   ~P3ABandwidthSavingsTracker();
   P3ABandwidthSavingsTracker(const P3ABandwidthSavingsTracker&) = delete;
   P3ABandwidthSavingsTracker& operator=(const P3ABandwidthSavingsTracker&) =
@@ -33,7 +38,8 @@ class P3ABandwidthSavingsTracker {
   void RecordSavings(uint64_t savings);
 
  private:
-  PrefService* user_prefs_;
+  PrefService* user_prefs_ = nullptr;
+  WeeklyStorage* weekly_storage_ = nullptr;
   std::unique_ptr<base::Clock> clock_;  // Injected clock for testing
   void StoreSavingsHistogram(uint64_t savings_bytes);
 };
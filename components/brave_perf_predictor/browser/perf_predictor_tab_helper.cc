@@ -7,6 +7,8 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry_factory.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
+#include "brave/components/weekly_storage/weekly_storage_registry.h"
+#include "brave/components/weekly_storage/weekly_storage_registry_factory.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "components/user_prefs/user_prefs.h"
@@ -46,13 +48,7 @@ PerfPredictorTabHelper::PerfPredictorTabHelper(
     : WebContentsObserver(web_contents),
       bandwidth_predictor_(std::make_unique<BandwidthSavingsPredictor>(
           NamedThirdPartyRegistryFactory::GetForBrowserContext(
-              web_contents->GetBrowserContext()))) {
-  if (web_contents->GetBrowserContext()->IsOffTheRecord())
-    return;
-
-  bandwidth_tracker_ = std::make_unique<P3ABandwidthSavingsTracker>(
-      user_prefs::UserPrefs::Get(web_contents->GetBrowserContext()));
-}
+              web_contents->GetBrowserContext()))) {}
 
 PerfPredictorTabHelper::~PerfPredictorTabHelper() = default;
 
@@ -68,8 +64,8 @@ void PerfPredictorTabHelper::RegisterProfilePrefs(
 }
 
 // static
-void PerfPredictorTabHelper::DispatchBlockedEvent(
-    const std::string& subresource,
+void PerfPredictorTabHelper::DispatchBlockedEvents(
+    const std::vector<std::string>& subresources,
     int render_process_id,
     int render_frame_id,
     int frame_tree_node_id) {
@@ -84,7 +80,8 @@ void PerfPredictorTabHelper::DispatchBlockedEvent(
       brave_perf_predictor::PerfPredictorTabHelper::FromWebContents(
           web_contents);
   if (blocking_observer) {
-    blocking_observer->OnBlockedSubresource(subresource);
+    for (const auto& subresource : subresources)
+      blocking_observer->OnBlockedSubresource(subresource);
   }
 }
 
@@ -106,8 +103,17 @@ void PerfPredictorTabHelper::RecordSavings() {
             prefs::kBandwidthSavedBytes,
             prefs->GetUint64(prefs::kBandwidthSavedBytes) + savings);
 
-      if (bandwidth_tracker_)
-        bandwidth_tracker_->RecordSavings(savings);
+      // The registry owns the storage and drops it on shutdown, so look it up
+      // on each record rather than holding on to it
+      WeeklyStorageRegistry* registry =
+          browser_context->IsOffTheRecord()
+              ? nullptr
+              : WeeklyStorageRegistryFactory::GetForBrowserContext(
+                    browser_context);
+      WeeklyStorage* storage =
+          registry ? registry->Get(prefs::kBandwidthSavedDailyBytes) : nullptr;
+      if (storage)
+        P3ABandwidthSavingsTracker(storage).RecordSavings(savings);
 #if defined(OS_ANDROID)
         chrome::android::BraveShieldsContentSettings::DispatchSavedBandwidth(
           savings);
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "brave/components/brave_perf_predictor/browser/bandwidth_savings_predictor.h"
 #include "brave/components/brave_perf_predictor/browser/p3a_bandwidth_savings_tracker.h"
@@ -55,10 +56,11 @@ class PerfPredictorTabHelper
       const page_load_metrics::mojom::PageLoadTiming& timing);
   static void RegisterProfilePrefs(PrefRegistrySimple* registry);
   // Called from Brave Shields
-  static void DispatchBlockedEvent(const std::string& subresource,
-                                   int render_process_id,
-                                   int render_frame_id,
-                                   int frame_tree_node_id);
+  static void DispatchBlockedEvents(
+      const std::vector<std::string>& subresources,
+      int render_process_id,
+      int render_frame_id,
+      int frame_tree_node_id);
 
  private:
   friend class content::WebContentsUserData<PerfPredictorTabHelper>;
@@ -91,7 +93,6 @@ class PerfPredictorTabHelper
 
   int64_t navigation_id_ = -1;
   std::unique_ptr<BandwidthSavingsPredictor> bandwidth_predictor_;
-  std::unique_ptr<P3ABandwidthSavingsTracker> bandwidth_tracker_;
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
 };
@@ -32,7 +32,7 @@ constexpr std::array<double, standardise_feat_count> standardise_feat_scale = {
 {{transformers.standardise.scale | join(',\n')}}
 };
 
-const std::array<std::string, feature_count> feature_sequence{
+constexpr std::array<const char*, feature_count> feature_sequence{
     {% for feature in transformers.standardise.features %}
     "{{feature}}",
     {% endfor %}
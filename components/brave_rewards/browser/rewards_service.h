@@ -40,6 +40,9 @@ class RewardsServicePrivateObserver;
 
 using GetPublisherInfoListCallback =
     base::Callback<void(ledger::type::PublisherInfoList list)>;
+using GetPublisherInfoPageCallback =
+    base::OnceCallback<void(ledger::type::PublisherInfoList list,
+                            const uint32_t total)>;
 using GetAutoContributionAmountCallback = base::Callback<void(double)>;
 using GetAutoContributePropertiesCallback = base::Callback<void(
     ledger::type::AutoContributePropertiesPtr)>;
@@ -151,6 +154,13 @@ class RewardsService : public KeyedService {
       const uint32_t limit,
       ledger::type::ActivityInfoFilterPtr filter,
       const GetPublisherInfoListCallback& callback) = 0;
+  // Gets |limit| activity records from |start| and the number of records
+  // matching |filter|.
+  virtual void GetActivityInfoPage(
+      const uint32_t start,
+      const uint32_t limit,
+      ledger::type::ActivityInfoFilterPtr filter,
+      GetPublisherInfoPageCallback callback) = 0;
   virtual void GetExcludedList(
       const GetPublisherInfoListCallback& callback) = 0;
   virtual void FetchPromotions() = 0;
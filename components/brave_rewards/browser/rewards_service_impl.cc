@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/auto_reset.h"
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/command_line.h"
@@ -75,6 +76,7 @@
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
+#include "sql/database.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/gfx/image/image.h"
 #include "url/gurl.h"
@@ -466,11 +468,71 @@ void RewardsServiceImpl::OnLedgerCreated() {
 
   PrepareLedgerEnvForTesting();
 
+  SendLedgerState();
+
   bat_ledger_->Initialize(
       false,
       base::BindOnce(&RewardsServiceImpl::OnLedgerInitialized, AsWeakPtr()));
 }
 
+void RewardsServiceImpl::SendLedgerState() {
+  // The ledger reads its state through a copy kept in the utility process,
+  // seed it with every rewards pref and keep it up to date.
+  PrefService* pref_service = profile_->GetPrefs();
+  ledger_state_pref_change_registrar_.RemoveAll();
+  ledger_state_pref_change_registrar_.Init(pref_service);
+
+  const std::string prefix = base::StringPrintf("%s.", pref_prefix);
+  std::vector<std::string> paths;
+  pref_service->IteratePreferenceValues(base::BindRepeating(
+      [](const std::string& prefix,
+         std::vector<std::string>* paths,
+         const std::string& path,
+         const base::Value& value) {
+        if (base::StartsWith(path, prefix, base::CompareCase::SENSITIVE)) {
+          paths->push_back(path);
+        }
+      },
+      prefix,
+      &paths));
+
+  base::flat_map<std::string, base::Value> state;
+  for (const auto& path : paths) {
+    state.emplace(path.substr(prefix.size()),
+                  pref_service->Get(path)->Clone());
+    ledger_state_pref_change_registrar_.Add(
+        path,
+        base::BindRepeating(&RewardsServiceImpl::OnLedgerStatePrefChanged,
+                            base::Unretained(this)));
+  }
+
+  bat_ledger_->OnStateChanged(std::move(state));
+}
+
+void RewardsServiceImpl::OnLedgerStatePrefChanged(const std::string& path) {
+  // Writes made by the ledger are acknowledged by OnLedgerStateWritten().
+  if (updating_ledger_state_ || !Connected()) {
+    return;
+  }
+
+  const std::string prefix = base::StringPrintf("%s.", pref_prefix);
+  base::flat_map<std::string, base::Value> state;
+  state.emplace(path.substr(prefix.size()),
+                profile_->GetPrefs()->Get(path)->Clone());
+  bat_ledger_->OnStateChanged(std::move(state));
+}
+
+void RewardsServiceImpl::OnLedgerStateWritten(const std::string& name) {
+  // The ledger drops changes to |name| until each of its writes is
+  // acknowledged, so an older change can't overwrite its copy.
+  if (!Connected()) {
+    return;
+  }
+
+  const base::Value* value = profile_->GetPrefs()->Get(GetPrefPath(name));
+  bat_ledger_->OnStateWritten(name, value ? value->Clone() : base::Value());
+}
+
 void RewardsServiceImpl::OnResult(
     ledger::ResultCallback callback,
     const ledger::type::Result result) {
@@ -593,6 +655,22 @@ void RewardsServiceImpl::GetActivityInfoList(
                      callback));
 }
 
+void RewardsServiceImpl::GetActivityInfoPage(
+    const uint32_t start,
+    const uint32_t limit,
+    ledger::type::ActivityInfoFilterPtr filter,
+    GetPublisherInfoPageCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
+  bat_ledger_->GetActivityInfoPage(
+      start,
+      limit,
+      std::move(filter),
+      std::move(callback));
+}
+
 void RewardsServiceImpl::GetExcludedList(
     const GetPublisherInfoListCallback& callback) {
   if (!Connected()) {
@@ -1373,12 +1451,12 @@ bool RewardsServiceImpl::ResetOnFilesTaskRunner() {
   const std::vector<base::FilePath> paths = {
     ledger_state_path_,
     publisher_state_path_,
-    publisher_info_db_path_,
     diagnostic_log_path_,
     publisher_list_path_,
   };
 
-  bool res = true;
+  // Also deletes the write-ahead log, which must not outlive the database
+  bool res = sql::Database::Delete(publisher_info_db_path_);
   for (size_t i = 0; i < paths.size(); i++) {
     if (!base::DeletePathRecursively(paths[i])) {
       res = false;
@@ -1414,7 +1492,9 @@ void RewardsServiceImpl::Reset() {
 }
 
 void RewardsServiceImpl::SetBooleanState(const std::string& name, bool value) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->SetBoolean(GetPrefPath(name), value);
+  OnLedgerStateWritten(name);
 }
 
 bool RewardsServiceImpl::GetBooleanState(const std::string& name) const {
@@ -1422,7 +1502,9 @@ bool RewardsServiceImpl::GetBooleanState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::SetIntegerState(const std::string& name, int value) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->SetInteger(GetPrefPath(name), value);
+  OnLedgerStateWritten(name);
 }
 
 int RewardsServiceImpl::GetIntegerState(const std::string& name) const {
@@ -1430,7 +1512,9 @@ int RewardsServiceImpl::GetIntegerState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::SetDoubleState(const std::string& name, double value) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->SetDouble(GetPrefPath(name), value);
+  OnLedgerStateWritten(name);
 }
 
 double RewardsServiceImpl::GetDoubleState(const std::string& name) const {
@@ -1439,7 +1523,9 @@ double RewardsServiceImpl::GetDoubleState(const std::string& name) const {
 
 void RewardsServiceImpl::SetStringState(const std::string& name,
                                         const std::string& value) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->SetString(GetPrefPath(name), value);
+  OnLedgerStateWritten(name);
 }
 
 std::string RewardsServiceImpl::GetStringState(const std::string& name) const {
@@ -1447,7 +1533,9 @@ std::string RewardsServiceImpl::GetStringState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::SetInt64State(const std::string& name, int64_t value) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->SetInt64(GetPrefPath(name), value);
+  OnLedgerStateWritten(name);
 }
 
 int64_t RewardsServiceImpl::GetInt64State(const std::string& name) const {
@@ -1456,7 +1544,9 @@ int64_t RewardsServiceImpl::GetInt64State(const std::string& name) const {
 
 void RewardsServiceImpl::SetUint64State(const std::string& name,
                                         uint64_t value) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->SetUint64(GetPrefPath(name), value);
+  OnLedgerStateWritten(name);
 }
 
 uint64_t RewardsServiceImpl::GetUint64State(const std::string& name) const {
@@ -1464,7 +1554,9 @@ uint64_t RewardsServiceImpl::GetUint64State(const std::string& name) const {
 }
 
 void RewardsServiceImpl::ClearState(const std::string& name) {
+  base::AutoReset<bool> updating(&updating_ledger_state_, true);
   profile_->GetPrefs()->ClearPref(GetPrefPath(name));
+  OnLedgerStateWritten(name);
 }
 
 bool RewardsServiceImpl::GetBooleanOption(const std::string& name) const {
@@ -134,6 +134,12 @@ class RewardsServiceImpl : public RewardsService,
       ledger::type::ActivityInfoFilterPtr filter,
       const GetPublisherInfoListCallback& callback) override;
 
+  void GetActivityInfoPage(
+      const uint32_t start,
+      const uint32_t limit,
+      ledger::type::ActivityInfoFilterPtr filter,
+      GetPublisherInfoPageCallback callback) override;
+
   void GetExcludedList(const GetPublisherInfoListCallback& callback) override;
 
   void OnGetPublisherInfoList(
@@ -352,7 +358,6 @@ class RewardsServiceImpl : public RewardsService,
       base::OnceCallback<void(bool)> callback);
   void CheckInsufficientFundsForTesting();
   void ForTestingSetTestResponseCallback(GetTestResponseCallback callback);
-
  private:
   friend class ::RewardsFlagBrowserTest;
 
@@ -384,6 +389,12 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnLedgerCreated();
 
+  void SendLedgerState();
+
+  void OnLedgerStatePrefChanged(const std::string& path);
+
+  void OnLedgerStateWritten(const std::string& name);
+
   void OnResult(
       ledger::ResultCallback callback,
       const ledger::type::Result result);
@@ -797,6 +808,8 @@ class RewardsServiceImpl : public RewardsService,
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
   PrefChangeRegistrar profile_pref_change_registrar_;
+  PrefChangeRegistrar ledger_state_pref_change_registrar_;
+  bool updating_ledger_state_ = false;
 
   uint32_t next_timer_id_;
   int32_t country_id_ = 0;
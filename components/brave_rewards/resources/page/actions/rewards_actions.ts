@@ -84,6 +84,14 @@ export const onContributeList = (list: Rewards.Publisher[]) => action(types.ON_C
   list
 })
 
+export const onContributeListPage = (page: Rewards.ContributeListPage) => action(types.ON_CONTRIBUTE_LIST_PAGE, {
+  page
+})
+
+export const onContributeListChanged = (delta: Rewards.ContributeListDelta) => action(types.ON_CONTRIBUTE_LIST_CHANGED, {
+  delta
+})
+
 export const onExcludedList = (list: Rewards.ExcludedPublisher[]) => action(types.ON_EXCLUDED_LIST, {
   list
 })
@@ -125,7 +133,9 @@ export const onCurrentTips = (list: Rewards.Publisher[]) => action(types.ON_CURR
 
 export const getTipTable = () => action(types.GET_TIP_TABLE)
 
-export const getContributeList = () => action(types.GET_CONTRIBUTE_LIST)
+export const getContributeList = (start: number = 0) => action(types.GET_CONTRIBUTE_LIST, {
+  start
+})
 
 export const getAdsData = () => action(types.GET_ADS_DATA)
 
@@ -91,6 +91,14 @@ window.cr.define('brave_rewards', function () {
     getActions().onContributeList(list)
   }
 
+  function contributeListPage (page: Rewards.ContributeListPage) {
+    getActions().onContributeListPage(page)
+  }
+
+  function contributeListChanged (delta: Rewards.ContributeListDelta) {
+    getActions().onContributeListChanged(delta)
+  }
+
   function excludedList (list: Rewards.ExcludedPublisher[]) {
     getActions().onExcludedList(list)
   }
@@ -274,6 +282,8 @@ window.cr.define('brave_rewards', function () {
     promotionFinish,
     reconcileStamp,
     contributeList,
+    contributeListPage,
+    contributeListChanged,
     excludedList,
     balanceReport,
     contributionAmount,
@@ -122,6 +122,13 @@ class ContributeBox extends React.Component<Props, State> {
   }
 
   onModalContributeToggle = () => {
+    if (!this.state.modalContribute) {
+      const { autoContributeList, autoContributeListTotal } = this.props.rewardsData
+      if (autoContributeList.length < (autoContributeListTotal || 0)) {
+        this.actions.getContributeList(autoContributeList.length)
+      }
+    }
+
     this.setState({
       modalContribute: !this.state.modalContribute
     })
@@ -214,6 +221,7 @@ class ContributeBox extends React.Component<Props, State> {
       enabledContribute,
       reconcileStamp,
       autoContributeList,
+      autoContributeListTotal,
       excludedList,
       ui
     } = this.props.rewardsData
@@ -221,7 +229,7 @@ class ContributeBox extends React.Component<Props, State> {
     const contributeRows = this.getContributeRows(autoContributeList)
     const excludedRows = this.getExcludedRows(excludedList)
     const topRows = contributeRows.slice(0, 5)
-    const numRows = contributeRows && contributeRows.length
+    const numRows = Math.max(autoContributeListTotal || 0, contributeRows.length)
     const numExcludedRows = excludedRows && excludedRows.length
     const allSites = !(excludedRows.length > 0 || numRows > 5)
     const showDisabled = firstLoad !== false || !enabledContribute
@@ -0,0 +1,7 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Number of auto-contribute publishers requested at a time, the rest of the
+// list is loaded when all sites are shown
+export const contributeListPageSize = 20
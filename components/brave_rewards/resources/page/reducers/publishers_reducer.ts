@@ -6,6 +6,7 @@ import { Reducer } from 'redux'
 
 // Constant
 import { types } from '../constants/rewards_types'
+import { contributeListPageSize } from '../constants/rewards_constants'
 
 const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.State, action) => {
   if (!state) {
@@ -22,7 +23,64 @@ const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.St
       }
 
       state.autoContributeList = action.payload.list
+      state.autoContributeListTotal = action.payload.list.length
       break
+    case types.ON_CONTRIBUTE_LIST_PAGE: {
+      const page: Rewards.ContributeListPage = action.payload.page
+      if (!page) {
+        break
+      }
+
+      state = { ...state }
+      if (state.contributeLoad) {
+        state.firstLoad = false
+      } else {
+        state.contributeLoad = true
+      }
+
+      let list: Rewards.Publisher[] = []
+      if (page.start > 0) {
+        const keys = new Set(page.list.map((item) => item.publisherKey))
+        list = state.autoContributeList.filter((item) => !keys.has(item.publisherKey))
+      }
+
+      state.autoContributeList = list.concat(page.list)
+      state.autoContributeListTotal = page.total
+
+      // Only the first page is requested up front, once later pages are
+      // requested the rest of the list is loaded page by page
+      const next = page.start + page.list.length
+      if (page.start > 0 && page.list.length > 0 && next < page.total) {
+        chrome.send('brave_rewards.getContributionList', [next, contributeListPageSize])
+      }
+      break
+    }
+    case types.ON_CONTRIBUTE_LIST_CHANGED: {
+      const delta: Rewards.ContributeListDelta = action.payload.delta
+      if (!delta) {
+        break
+      }
+
+      state = { ...state }
+      const removed = new Set(delta.removed)
+      const changed = new Map(delta.changed.map((item) => [item.publisherKey, item] as [string, Rewards.Publisher]))
+      const list = state.autoContributeList
+        .filter((item) => !removed.has(item.publisherKey))
+        .map((item) => {
+          const publisher = changed.get(item.publisherKey)
+          if (!publisher) {
+            return item
+          }
+
+          changed.delete(item.publisherKey)
+          return publisher
+        })
+        .concat(Array.from(changed.values()))
+
+      state.autoContributeList = list.sort((a, b) => b.percentage - a.percentage)
+      state.autoContributeListTotal = delta.total
+      break
+    }
     case types.ON_EXCLUDED_LIST: {
       if (!action.payload.list) {
         break
@@ -86,7 +144,7 @@ const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.St
       chrome.send('brave_rewards.getExcludedSites')
       break
     case types.ON_RECONCILE_STAMP_RESET:
-      chrome.send('brave_rewards.getContributionList')
+      chrome.send('brave_rewards.getContributionList', [0, contributeListPageSize])
       break
   }
 
@@ -8,6 +8,7 @@ import { OnboardingCompletedStore } from '../../shared/lib/onboarding_completed_
 
 // Constant
 import { types } from '../constants/rewards_types'
+import { contributeListPageSize } from '../constants/rewards_constants'
 import { defaultState } from '../storage'
 
 const onboardingCompletedStore = new OnboardingCompletedStore()
@@ -110,7 +111,8 @@ const rewardsReducer: Reducer<Rewards.State | undefined> = (state: Rewards.State
       break
     }
     case types.GET_CONTRIBUTE_LIST: {
-      chrome.send('brave_rewards.getContributionList')
+      const start: number = action.payload.start || 0
+      chrome.send('brave_rewards.getContributionList', [start, contributeListPageSize])
       break
     }
     case types.GET_ADS_DATA: {
@@ -32,6 +32,7 @@ export const defaultState: Rewards.State = {
     promosDismissed: {}
   },
   autoContributeList: [],
+  autoContributeListTotal: 0,
   recurringList: [],
   tipsList: [],
   contributeLoad: false,
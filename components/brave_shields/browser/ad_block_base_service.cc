@@ -11,106 +11,156 @@
 #include <vector>
 
 #include "base/bind.h"
+#include "base/callback.h"
 #include "base/files/file_path.h"
-#include "base/json/json_reader.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/synchronization/lock.h"
 #include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_engine_snapshot.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
-#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
-#include "url/origin.h"
 
 using brave_component_updater::BraveComponent;
 using content::BrowserThread;
-using namespace net::registry_controlled_domains;  // NOLINT
 
 namespace {
 
-std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
-  std::string filter_option = "";
-  switch (resource_type) {
-    // top level page
-    case blink::mojom::ResourceType::kMainFrame:
-      filter_option = "main_frame";
-      break;
-    // frame or iframe
-    case blink::mojom::ResourceType::kSubFrame:
-      filter_option = "sub_frame";
-      break;
-    // a CSS stylesheet
-    case blink::mojom::ResourceType::kStylesheet:
-      filter_option = "stylesheet";
-      break;
-    // an external script
-    case blink::mojom::ResourceType::kScript:
-      filter_option = "script";
-      break;
-    // an image (jpg/gif/png/etc)
-    case blink::mojom::ResourceType::kFavicon:
-    case blink::mojom::ResourceType::kImage:
-      filter_option = "image";
-      break;
-    // a font
-    case blink::mojom::ResourceType::kFontResource:
-      filter_option = "font";
-      break;
-    // an "other" subresource.
-    case blink::mojom::ResourceType::kSubResource:
-      filter_option = "other";
-      break;
-    // an object (or embed) tag for a plugin.
-    case blink::mojom::ResourceType::kObject:
-      filter_option = "object";
-      break;
-    // a media resource.
-    case blink::mojom::ResourceType::kMedia:
-      filter_option = "media";
-      break;
-    // a XMLHttpRequest
-    case blink::mojom::ResourceType::kXhr:
-      filter_option = "xhr";
-      break;
-    // a ping request for <a ping>/sendBeacon.
-    case blink::mojom::ResourceType::kPing:
-      filter_option = "ping";
-      break;
-    // the main resource of a dedicated worker.
-    case blink::mojom::ResourceType::kWorker:
-    // the main resource of a shared worker.
-    case blink::mojom::ResourceType::kSharedWorker:
-    // an explicitly requested prefetch
-    case blink::mojom::ResourceType::kPrefetch:
-    // the main resource of a service worker.
-    case blink::mojom::ResourceType::kServiceWorker:
-    // a report of Content Security Policy violations.
-    case blink::mojom::ResourceType::kCspReport:
-    // a resource that a plugin requested.
-    case blink::mojom::ResourceType::kPluginResource:
-    default:
-      break;
+using EngineFactory =
+    base::RepeatingCallback<std::unique_ptr<adblock::Engine>()>;
+
+std::unique_ptr<adblock::Engine> CreateEngineFromDATBuffer(
+    const brave_component_updater::DATFileDataBuffer* buffer) {
+  auto engine = std::make_unique<adblock::Engine>();
+  if (!engine->deserialize(reinterpret_cast<const char*>(buffer->data()),
+                           buffer->size())) {
+    return nullptr;
   }
-  return filter_option;
+  return engine;
+}
+
+std::unique_ptr<adblock::Engine> CreateEngineFromRules(
+    const std::string& rules) {
+  return std::make_unique<adblock::Engine>(rules);
 }
 
 }  // namespace
 
 namespace brave_shields {
 
+// Published snapshots are never changed, so a tag or resources change builds
+// a new engine from the same source. Everything but GetEngine() runs on the
+// service's task runner.
+class AdBlockBaseService::EngineBuilder {
+ public:
+  EngineBuilder() {
+    Publish(std::make_unique<adblock::Engine>());
+  }
+
+  scoped_refptr<AdBlockEngineSnapshot> GetEngine() const {
+    base::AutoLock lock(engine_lock_);
+    return engine_;
+  }
+
+  void SetEngine(std::unique_ptr<adblock::Engine> engine,
+                 EngineFactory factory) {
+    factory_ = std::move(factory);
+    rebuild_pending_ = false;
+    Publish(std::move(engine));
+  }
+
+  void EnableTag(const std::string& tag, bool enabled) {
+    auto it = std::find(tags_.begin(), tags_.end(), tag);
+    if (enabled && it == tags_.end()) {
+      tags_.push_back(tag);
+    } else if (!enabled && it != tags_.end()) {
+      tags_.erase(it);
+    } else {
+      return;
+    }
+    ScheduleRebuild();
+  }
+
+  void SetResources(const std::string& resources) {
+    resources_ = resources;
+    ScheduleRebuild();
+  }
+
+ private:
+  // Several changes usually arrive together at startup, so they share one
+  // rebuild.
+  void ScheduleRebuild() {
+    if (rebuild_pending_)
+      return;
+    rebuild_pending_ = true;
+    // Unretained is safe, the builder is deleted on this sequence after the
+    // task.
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&EngineBuilder::Rebuild, base::Unretained(this)));
+  }
+
+  void Rebuild() {
+    // A new engine may have been set since, which already has the changes.
+    if (!rebuild_pending_)
+      return;
+    rebuild_pending_ = false;
+
+    std::unique_ptr<adblock::Engine> engine;
+    if (factory_)
+      engine = factory_.Run();
+    if (!engine)
+      engine = std::make_unique<adblock::Engine>();
+    Publish(std::move(engine));
+  }
+
+  void Publish(std::unique_ptr<adblock::Engine> engine) {
+    for (const auto& tag : tags_)
+      engine->addTag(tag);
+    if (!resources_.empty())
+      engine->addResources(resources_);
+
+    auto snapshot =
+        base::MakeRefCounted<AdBlockEngineSnapshot>(std::move(engine));
+    {
+      base::AutoLock lock(engine_lock_);
+      engine_.swap(snapshot);
+    }
+    // The previous engine is released outside the lock, and is destroyed
+    // once the last match still using it is done.
+  }
+
+  // Keeps the DAT buffer of the list, if any, so the engine can be rebuilt.
+  EngineFactory factory_;
+  std::vector<std::string> tags_;
+  std::string resources_;
+  bool rebuild_pending_ = false;
+
+  mutable base::Lock engine_lock_;
+  scoped_refptr<AdBlockEngineSnapshot> engine_;
+
+  DISALLOW_COPY_AND_ASSIGN(EngineBuilder);
+};
+
 AdBlockBaseService::AdBlockBaseService(BraveComponent::Delegate* delegate)
     : BaseBraveShieldsService(delegate),
-      ad_block_client_(new adblock::Engine()),
+      engine_builder_(std::make_unique<EngineBuilder>()),
+      matching_task_runner_(base::ThreadPool::CreateTaskRunner(
+          {base::TaskPriority::USER_BLOCKING,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})),
       weak_factory_(this) {}
 
 AdBlockBaseService::~AdBlockBaseService() {
-  GetTaskRunner()->DeleteSoon(FROM_HERE, ad_block_client_.release());
+  GetTaskRunner()->DeleteSoon(FROM_HERE, engine_builder_.release());
 }
 
 void AdBlockBaseService::ShouldStartRequest(
@@ -121,19 +171,9 @@ void AdBlockBaseService::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-
-  // Determine third-party here so the library doesn't need to figure it out.
-  // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
-  // a URL or origin and not a string to a host name.
-  bool is_third_party = !SameDomainOrHost(
-      url,
-      url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
-      INCLUDE_PRIVATE_REGISTRIES);
-  ad_block_client_->matches(
-      url.spec(), url.host(), tab_host, is_third_party,
-      ResourceTypeToString(resource_type), did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+  GetEngine()->ShouldStartRequest(url, resource_type, tab_host,
+                                  did_match_rule, did_match_exception,
+                                  did_match_important, mock_data_url);
 
   // LOG(ERROR) << "AdBlockBaseService::ShouldStartRequest(), host: "
   //  << tab_host
@@ -142,55 +182,41 @@ void AdBlockBaseService::ShouldStartRequest(
 }
 
 void AdBlockBaseService::EnableTag(const std::string& tag, bool enabled) {
-  if (BrowserThread::CurrentlyOn(BrowserThread::UI)) {
-    GetTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&AdBlockBaseService::EnableTag,
-                                  base::Unretained(this), tag, enabled));
-    return;
-  }
-
-  if (enabled) {
-    ad_block_client_->addTag(tag);
-    tags_.push_back(tag);
-  } else {
-    ad_block_client_->removeTag(tag);
-    std::vector<std::string>::iterator it =
-        std::find(tags_.begin(), tags_.end(), tag);
-    if (it != tags_.end()) {
-      tags_.erase(it);
-    }
-  }
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&EngineBuilder::EnableTag,
+                     base::Unretained(engine_builder_.get()), tag, enabled));
 }
 
 void AdBlockBaseService::AddResources(const std::string& resources) {
-  if (BrowserThread::CurrentlyOn(BrowserThread::UI)) {
-    GetTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&AdBlockBaseService::AddResources,
-                                  base::Unretained(this), resources));
-    return;
-  }
-
-  ad_block_client_->addResources(resources);
-  resources_ = resources;
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&EngineBuilder::SetResources,
+                     base::Unretained(engine_builder_.get()), resources));
 }
 
 bool AdBlockBaseService::TagExists(const std::string& tag) {
-  return std::find(tags_.begin(), tags_.end(), tag) != tags_.end();
+  return GetEngine()->TagExists(tag);
 }
 
 base::Optional<base::Value> AdBlockBaseService::UrlCosmeticResources(
         const std::string& url) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  return base::JSONReader::Read(ad_block_client_->urlCosmeticResources(url));
+  return GetEngine()->UrlCosmeticResources(url);
 }
 
 base::Optional<base::Value> AdBlockBaseService::HiddenClassIdSelectors(
         const std::vector<std::string>& classes,
         const std::vector<std::string>& ids,
         const std::vector<std::string>& exceptions) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  return base::JSONReader::Read(
-      ad_block_client_->hiddenClassIdSelectors(classes, ids, exceptions));
+  return GetEngine()->HiddenClassIdSelectors(classes, ids, exceptions);
+}
+
+scoped_refptr<AdBlockEngineSnapshot> AdBlockBaseService::GetEngine() const {
+  return engine_builder_->GetEngine();
+}
+
+scoped_refptr<base::TaskRunner> AdBlockBaseService::GetMatchingTaskRunner() {
+  return matching_task_runner_;
 }
 
 void AdBlockBaseService::GetDATFileData(const base::FilePath& dat_file_path) {
@@ -211,27 +237,21 @@ void AdBlockBaseService::OnGetDATFileData(GetDATFileDataResult result) {
     LOG(ERROR) << "Failed to deserialize ad block data";
     return;
   }
+  // The DAT buffer is kept so the engine can be rebuilt from it.
   GetTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&AdBlockBaseService::UpdateAdBlockClient,
-                                base::Unretained(this),
-                                std::move(result.first)));
+      FROM_HERE,
+      base::BindOnce(
+          &EngineBuilder::SetEngine, base::Unretained(engine_builder_.get()),
+          std::move(result.first),
+          base::BindRepeating(
+              &CreateEngineFromDATBuffer,
+              base::Owned(new brave_component_updater::DATFileDataBuffer(
+                  std::move(result.second))))));
 }
 
-void AdBlockBaseService::UpdateAdBlockClient(
-    std::unique_ptr<adblock::Engine> ad_block_client) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_ = std::move(ad_block_client);
-  AddKnownTagsToAdBlockInstance();
-  AddKnownResourcesToAdBlockInstance();
-}
-
-void AdBlockBaseService::AddKnownTagsToAdBlockInstance() {
-  std::for_each(tags_.begin(), tags_.end(),
-                [&](const std::string tag) { ad_block_client_->addTag(tag); });
-}
-
-void AdBlockBaseService::AddKnownResourcesToAdBlockInstance() {
-  ad_block_client_->addResources(resources_);
+void AdBlockBaseService::ResetEngineFromRules(const std::string& rules) {
+  engine_builder_->SetEngine(std::make_unique<adblock::Engine>(rules),
+                             base::BindRepeating(&CreateEngineFromRules, rules));
 }
 
 bool AdBlockBaseService::Init() {
@@ -243,12 +263,9 @@ void AdBlockBaseService::ResetForTest(const std::string& rules,
   // This is temporary until adblock-rust supports incrementally adding
   // filter rules to an existing instance. At which point the hack below
   // will dissapear.
-  ad_block_client_.reset(new adblock::Engine(rules));
-  AddKnownTagsToAdBlockInstance();
-  if (!resources.empty()) {
-    resources_ = resources;
-  }
-  AddKnownResourcesToAdBlockInstance();
+  if (!resources.empty())
+    engine_builder_->SetResources(resources);
+  ResetEngineFromRules(rules);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
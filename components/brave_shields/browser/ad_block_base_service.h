@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/values.h"
@@ -28,8 +29,15 @@ namespace adblock {
 class Engine;
 }
 
+namespace base {
+class SequencedTaskRunner;
+class TaskRunner;
+}
+
 namespace brave_shields {
 
+class AdBlockEngineSnapshot;
+
 // The base class of the brave shields service in charge of ad-block
 // checking and init.
 class AdBlockBaseService : public BaseBraveShieldsService {
@@ -58,25 +66,33 @@ class AdBlockBaseService : public BaseBraveShieldsService {
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions);
 
+  // The engine currently in use. Matching against it needs no lock, and it
+  // stays valid after the rules change for as long as it is referenced.
+  scoped_refptr<AdBlockEngineSnapshot> GetEngine() const;
+
+  // Matching (ShouldStartRequest, UrlCosmeticResources and
+  // HiddenClassIdSelectors) may run concurrently and should be posted here
+  // rather than to GetTaskRunner(), which serializes all of it.
+  scoped_refptr<base::TaskRunner> GetMatchingTaskRunner();
+
  protected:
   friend class ::AdBlockServiceTest;
   bool Init() override;
 
   void GetDATFileData(const base::FilePath& dat_file_path);
-  void AddKnownTagsToAdBlockInstance();
-  void AddKnownResourcesToAdBlockInstance();
+  void ResetEngineFromRules(const std::string& rules);
   void ResetForTest(const std::string& rules, const std::string& resources);
 
-  std::unique_ptr<adblock::Engine> ad_block_client_;
-
  private:
-  void UpdateAdBlockClient(
-      std::unique_ptr<adblock::Engine> ad_block_client);
+  class EngineBuilder;
+
   void OnGetDATFileData(GetDATFileDataResult result);
   void OnPreferenceChanges(const std::string& pref_name);
 
-  std::vector<std::string> tags_;
-  std::string resources_;
+  // Rebuilds and publishes the engine on GetTaskRunner(). It is deleted on
+  // that sequence too, after any task already posted for it has run.
+  std::unique_ptr<EngineBuilder> engine_builder_;
+  scoped_refptr<base::TaskRunner> matching_task_runner_;
   base::WeakPtrFactory<AdBlockBaseService> weak_factory_;
   DISALLOW_COPY_AND_ASSIGN(AdBlockBaseService);
 };
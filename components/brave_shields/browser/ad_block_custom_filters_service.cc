@@ -85,7 +85,7 @@ bool AdBlockCustomFiltersService::MigrateLegacyCosmeticFilters(
 void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
     const std::string& custom_filters) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  ResetEngineFromRules(custom_filters);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,70 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_SNAPSHOT_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/optional.h"
+#include "base/values.h"
+#include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
+
+class GURL;
+
+namespace adblock {
+class Engine;
+}
+
+namespace brave_shields {
+
+// An adblock engine that is never modified once it is published, so any
+// number of threads can match against it at the same time. Rule list, tag and
+// resource changes publish a new snapshot instead of changing this one. A
+// snapshot stays alive for as long as a match that started on it is running.
+class AdBlockEngineSnapshot
+    : public base::RefCountedThreadSafe<AdBlockEngineSnapshot> {
+ public:
+  explicit AdBlockEngineSnapshot(std::unique_ptr<adblock::Engine> engine);
+
+  void ShouldStartRequest(const GURL& url,
+                          blink::mojom::ResourceType resource_type,
+                          const std::string& tab_host,
+                          bool* did_match_rule,
+                          bool* did_match_exception,
+                          bool* did_match_important,
+                          std::string* mock_data_url) const;
+  base::Optional<base::Value> UrlCosmeticResources(
+      const std::string& url) const;
+  base::Optional<base::Value> HiddenClassIdSelectors(
+      const std::vector<std::string>& classes,
+      const std::vector<std::string>& ids,
+      const std::vector<std::string>& exceptions) const;
+
+  bool TagExists(const std::string& tag) const;
+
+  // Changes whenever a snapshot is created or destroyed, so whenever the rules
+  // of any list change or a list goes away. Results derived from the engines
+  // can be cached against it. Thread-safe.
+  static uint64_t GetRulesVersion();
+
+ private:
+  friend class base::RefCountedThreadSafe<AdBlockEngineSnapshot>;
+  ~AdBlockEngineSnapshot();
+
+  const std::unique_ptr<adblock::Engine> engine_;
+
+  DISALLOW_COPY_AND_ASSIGN(AdBlockEngineSnapshot);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_SNAPSHOT_H_
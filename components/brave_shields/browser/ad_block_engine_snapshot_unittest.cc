@@ -0,0 +1,107 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_engine_snapshot.h"
+
+#include <memory>
+#include <string>
+
+#include "base/barrier_closure.h"
+#include "base/bind.h"
+#include "base/run_loop.h"
+#include "base/task/thread_pool.h"
+#include "base/test/task_environment.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kRules[] = "||ads.example.com^\nadbanner$tag=test-tag";
+
+scoped_refptr<AdBlockEngineSnapshot> CreateSnapshot(
+    std::unique_ptr<adblock::Engine> engine) {
+  return base::MakeRefCounted<AdBlockEngineSnapshot>(std::move(engine));
+}
+
+bool Matches(const AdBlockEngineSnapshot& snapshot, const std::string& url) {
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string mock_data_url;
+  snapshot.ShouldStartRequest(GURL(url), blink::mojom::ResourceType::kScript,
+                              "example.org", &did_match_rule,
+                              &did_match_exception, &did_match_important,
+                              &mock_data_url);
+  return did_match_rule && !did_match_exception;
+}
+
+}  // namespace
+
+class AdBlockEngineSnapshotTest : public ::testing::Test {
+ protected:
+  base::test::TaskEnvironment task_environment_;
+};
+
+TEST_F(AdBlockEngineSnapshotTest, MatchesRules) {
+  auto snapshot = CreateSnapshot(std::make_unique<adblock::Engine>(kRules));
+
+  EXPECT_TRUE(Matches(*snapshot, "https://ads.example.com/ad.js"));
+  EXPECT_FALSE(Matches(*snapshot, "https://example.com/ad.js"));
+}
+
+TEST_F(AdBlockEngineSnapshotTest, KeepsTagsOfEngine) {
+  auto engine = std::make_unique<adblock::Engine>(kRules);
+  engine->addTag("test-tag");
+  auto tagged = CreateSnapshot(std::move(engine));
+  auto untagged = CreateSnapshot(std::make_unique<adblock::Engine>(kRules));
+
+  EXPECT_TRUE(tagged->TagExists("test-tag"));
+  EXPECT_TRUE(Matches(*tagged, "https://example.com/adbanner.js"));
+  EXPECT_FALSE(untagged->TagExists("test-tag"));
+  EXPECT_FALSE(Matches(*untagged, "https://example.com/adbanner.js"));
+}
+
+TEST_F(AdBlockEngineSnapshotTest, MatchesConcurrently) {
+  auto snapshot = CreateSnapshot(std::make_unique<adblock::Engine>(kRules));
+
+  constexpr int kMatches = 16;
+  int matched = 0;
+  base::RunLoop run_loop;
+  auto on_match = base::BarrierClosure(kMatches, run_loop.QuitClosure());
+  for (int i = 0; i < kMatches; i++) {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {},
+        base::BindOnce(
+            [](scoped_refptr<AdBlockEngineSnapshot> snapshot) {
+              return Matches(*snapshot, "https://ads.example.com/ad.js");
+            },
+            snapshot),
+        base::BindOnce(
+            [](int* matched, base::RepeatingClosure on_match, bool result) {
+              if (result)
+                (*matched)++;
+              on_match.Run();
+            },
+            &matched, on_match));
+  }
+  run_loop.Run();
+
+  EXPECT_EQ(kMatches, matched);
+}
+
+TEST_F(AdBlockEngineSnapshotTest, RulesVersionChangesWithSnapshots) {
+  const uint64_t initial_version = AdBlockEngineSnapshot::GetRulesVersion();
+  auto snapshot = CreateSnapshot(std::make_unique<adblock::Engine>(kRules));
+  const uint64_t created_version = AdBlockEngineSnapshot::GetRulesVersion();
+  EXPECT_NE(initial_version, created_version);
+
+  snapshot.reset();
+  EXPECT_NE(created_version, AdBlockEngineSnapshot::GetRulesVersion());
+}
+
+}  // namespace brave_shields
@@ -15,6 +15,7 @@
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_engine_snapshot.h"
 #include "brave/components/brave_shields/browser/ad_block_regional_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
@@ -123,6 +124,19 @@ bool AdBlockRegionalServiceManager::Start() {
   return true;
 }
 
+std::vector<scoped_refptr<AdBlockEngineSnapshot>>
+AdBlockRegionalServiceManager::GetEngines() {
+  // Matching is slow, so only the engines are taken under the lock. Lists
+  // enabled or disabled meanwhile apply from the next match on.
+  std::vector<scoped_refptr<AdBlockEngineSnapshot>> engines;
+  base::AutoLock lock(regional_services_lock_);
+  engines.reserve(regional_services_.size());
+  for (const auto& regional_service : regional_services_) {
+    engines.push_back(regional_service.second->GetEngine());
+  }
+  return engines;
+}
+
 void AdBlockRegionalServiceManager::ShouldStartRequest(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
@@ -131,12 +145,10 @@ void AdBlockRegionalServiceManager::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
-  base::AutoLock lock(regional_services_lock_);
-
-  for (const auto& regional_service : regional_services_) {
-    regional_service.second->ShouldStartRequest(
-        url, resource_type, tab_host, did_match_rule, did_match_exception,
-        did_match_important, mock_data_url);
+  for (const auto& engine : GetEngines()) {
+    engine->ShouldStartRequest(url, resource_type, tab_host, did_match_rule,
+                               did_match_exception, did_match_important,
+                               mock_data_url);
     if (did_match_important && *did_match_important) {
       return;
     }
@@ -195,17 +207,15 @@ void AdBlockRegionalServiceManager::EnableFilterList(
 base::Optional<base::Value>
 AdBlockRegionalServiceManager::UrlCosmeticResources(
         const std::string& url) {
-  base::AutoLock lock(regional_services_lock_);
-  auto it = regional_services_.begin();
-  if (it == regional_services_.end()) {
+  const auto engines = GetEngines();
+  auto it = engines.begin();
+  if (it == engines.end()) {
     return base::Optional<base::Value>();
   }
-  base::Optional<base::Value> first_value =
-      it->second->UrlCosmeticResources(url);
+  base::Optional<base::Value> first_value = (*it)->UrlCosmeticResources(url);
 
-  for ( ; it != regional_services_.end(); it++) {
-    base::Optional<base::Value> next_value =
-        it->second->UrlCosmeticResources(url);
+  for ( ; it != engines.end(); it++) {
+    base::Optional<base::Value> next_value = (*it)->UrlCosmeticResources(url);
     if (first_value) {
       if (next_value) {
         MergeResourcesInto(std::move(*next_value), &*first_value, false);
@@ -223,17 +233,17 @@ AdBlockRegionalServiceManager::HiddenClassIdSelectors(
         const std::vector<std::string>& classes,
         const std::vector<std::string>& ids,
         const std::vector<std::string>& exceptions) {
-  base::AutoLock lock(regional_services_lock_);
-  auto it = regional_services_.begin();
-  if (it == regional_services_.end()) {
+  const auto engines = GetEngines();
+  auto it = engines.begin();
+  if (it == engines.end()) {
     return base::Optional<base::Value>();
   }
   base::Optional<base::Value> first_value =
-      it->second->HiddenClassIdSelectors(classes, ids, exceptions);
+      (*it)->HiddenClassIdSelectors(classes, ids, exceptions);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for ( ; it != engines.end(); it++) {
     base::Optional<base::Value> next_value =
-        it->second->HiddenClassIdSelectors(classes, ids, exceptions);
+        (*it)->HiddenClassIdSelectors(classes, ids, exceptions);
     if (first_value && first_value->is_list()) {
       if (next_value && next_value->is_list()) {
         for (auto i = next_value->GetList().begin();
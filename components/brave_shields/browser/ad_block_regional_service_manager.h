@@ -31,6 +31,7 @@ using brave_component_updater::BraveComponent;
 
 namespace brave_shields {
 
+class AdBlockEngineSnapshot;
 class AdBlockRegionalService;
 
 // The AdBlock regional service manager, in charge of initializing and
@@ -69,6 +70,7 @@ class AdBlockRegionalServiceManager {
   friend class ::AdBlockServiceTest;
   bool Init();
   void StartRegionalServices();
+  std::vector<scoped_refptr<AdBlockEngineSnapshot>> GetEngines();
   void UpdateFilterListPrefs(const std::string& uuid, bool enabled);
 
   brave_component_updater::BraveComponent::Delegate* delegate_;  // NOT OWNED
@@ -0,0 +1,74 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/blocked_event_buffer.h"
+
+#include <tuple>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/task/post_task.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave_shields {
+
+// static
+constexpr base::TimeDelta BlockedEventBuffer::kDefaultFlushDelay;
+
+bool BlockedEventBuffer::Frame::operator<(const Frame& other) const {
+  return std::tie(render_process_id, render_frame_id, frame_tree_node_id) <
+         std::tie(other.render_process_id, other.render_frame_id,
+                  other.frame_tree_node_id);
+}
+
+BlockedEventBuffer::BlockedEventBuffer(FlushCallback flush_callback)
+    : flush_callback_(std::move(flush_callback)) {}
+
+BlockedEventBuffer::~BlockedEventBuffer() = default;
+
+void BlockedEventBuffer::Add(const Frame& frame, Event event) {
+  base::AutoLock lock(lock_);
+  pending_events_[frame].push_back(std::move(event));
+  ++pending_events_count_;
+  if (flush_scheduled_)
+    return;
+
+  flush_scheduled_ = true;
+  base::PostDelayedTask(FROM_HERE, {content::BrowserThread::UI},
+                        base::BindOnce(&BlockedEventBuffer::Flush,
+                                       weak_factory_.GetWeakPtr()),
+                        flush_delay_);
+}
+
+void BlockedEventBuffer::Flush() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  std::map<Frame, std::vector<Event>> events;
+  size_t events_count = 0;
+  {
+    base::AutoLock lock(lock_);
+    events.swap(pending_events_);
+    std::swap(events_count, pending_events_count_);
+    flush_scheduled_ = false;
+  }
+
+  if (events.empty())
+    return;
+
+  // Without buffering, every event would have been its own UI task.
+  UMA_HISTOGRAM_COUNTS_1000("Brave.Shields.BlockedEventUITasksSaved",
+                            events_count - 1);
+  for (const auto& frame_events : events)
+    flush_callback_.Run(frame_events.first, frame_events.second);
+}
+
+void BlockedEventBuffer::set_flush_delay_for_testing(
+    base::TimeDelta flush_delay) {
+  base::AutoLock lock(lock_);
+  flush_delay_ = flush_delay;
+}
+
+}  // namespace brave_shields
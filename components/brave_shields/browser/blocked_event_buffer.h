@@ -0,0 +1,78 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BLOCKED_EVENT_BUFFER_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BLOCKED_EVENT_BUFFER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+
+namespace brave_shields {
+
+// Collects the requests blocked by shields and reports them to the UI thread
+// in batches grouped by frame, instead of posting one UI task per blocked
+// request. Events can be added from any thread. Pending events are flushed
+// after a short delay, or earlier when the page commits a new navigation.
+class BlockedEventBuffer {
+ public:
+  // Identifies the frame that made the blocked request.
+  struct Frame {
+    int render_process_id;
+    int render_frame_id;
+    int frame_tree_node_id;
+
+    bool operator<(const Frame& other) const;
+  };
+
+  struct Event {
+    std::string block_type;
+    std::string subresource;
+  };
+
+  // Runs on the UI thread once per frame that has pending events. Events are
+  // in the order they were added.
+  using FlushCallback =
+      base::RepeatingCallback<void(const Frame& frame,
+                                   const std::vector<Event>& events)>;
+
+  static constexpr base::TimeDelta kDefaultFlushDelay =
+      base::TimeDelta::FromMilliseconds(100);
+
+  explicit BlockedEventBuffer(FlushCallback flush_callback);
+  ~BlockedEventBuffer();
+
+  // Can be called on any thread.
+  void Add(const Frame& frame, Event event);
+
+  // Reports all pending events. Must be called on the UI thread.
+  void Flush();
+
+  void set_flush_delay_for_testing(base::TimeDelta flush_delay);
+
+ private:
+  FlushCallback flush_callback_;
+
+  base::Lock lock_;
+  // Guarded by |lock_|.
+  std::map<Frame, std::vector<Event>> pending_events_;
+  size_t pending_events_count_ = 0;
+  bool flush_scheduled_ = false;
+  base::TimeDelta flush_delay_ = kDefaultFlushDelay;
+
+  base::WeakPtrFactory<BlockedEventBuffer> weak_factory_{this};
+
+  DISALLOW_COPY_AND_ASSIGN(BlockedEventBuffer);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BLOCKED_EVENT_BUFFER_H_
@@ -0,0 +1,75 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/blocked_event_buffer.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_shields {
+
+class BlockedEventBufferTest : public testing::Test {
+ public:
+  BlockedEventBufferTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        buffer_(base::BindRepeating(&BlockedEventBufferTest::OnFlush,
+                                    base::Unretained(this))) {}
+
+ protected:
+  void OnFlush(const BlockedEventBuffer::Frame& frame,
+               const std::vector<BlockedEventBuffer::Event>& events) {
+    ++flush_count_;
+    for (const auto& event : events)
+      flushed_[frame.frame_tree_node_id].push_back(event.subresource);
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+  BlockedEventBuffer buffer_;
+  int flush_count_ = 0;
+  std::map<int, std::vector<std::string>> flushed_;
+};
+
+TEST_F(BlockedEventBufferTest, FlushesEventsPerFrameAfterDelay) {
+  base::HistogramTester histogram_tester;
+  buffer_.Add({1, 1, 1}, {"ads", "https://a.com/1.js"});
+  buffer_.Add({1, 2, 2}, {"ads", "https://a.com/2.js"});
+  buffer_.Add({1, 1, 1}, {"ads", "https://a.com/3.js"});
+
+  task_environment_.FastForwardBy(BlockedEventBuffer::kDefaultFlushDelay / 2);
+  EXPECT_EQ(0, flush_count_);
+
+  task_environment_.FastForwardBy(BlockedEventBuffer::kDefaultFlushDelay);
+  EXPECT_EQ(2, flush_count_);
+  EXPECT_EQ(std::vector<std::string>({"https://a.com/1.js",
+                                      "https://a.com/3.js"}),
+            flushed_[1]);
+  EXPECT_EQ(std::vector<std::string>({"https://a.com/2.js"}), flushed_[2]);
+  histogram_tester.ExpectUniqueSample("Brave.Shields.BlockedEventUITasksSaved",
+                                      2, 1);
+}
+
+TEST_F(BlockedEventBufferTest, ExplicitFlushReportsPendingEvents) {
+  buffer_.Add({1, 1, 1}, {"ads", "https://a.com/1.js"});
+  buffer_.Flush();
+  EXPECT_EQ(1, flush_count_);
+
+  // The scheduled flush has nothing left to report.
+  task_environment_.FastForwardBy(BlockedEventBuffer::kDefaultFlushDelay);
+  EXPECT_EQ(1, flush_count_);
+
+  // Later events schedule a new flush.
+  buffer_.Add({1, 1, 1}, {"ads", "https://a.com/2.js"});
+  task_environment_.FastForwardBy(BlockedEventBuffer::kDefaultFlushDelay);
+  EXPECT_EQ(2, flush_count_);
+  EXPECT_EQ(2u, flushed_[1].size());
+}
+
+}  // namespace brave_shields
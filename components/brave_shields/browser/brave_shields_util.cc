@@ -6,10 +6,15 @@
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "base/bind.h"
 #include "base/feature_list.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_perf_predictor/browser/buildflags.h"
+#include "brave/components/brave_shields/browser/blocked_event_buffer.h"
 #include "brave/components/brave_shields/browser/brave_shields_p3a.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
@@ -44,6 +49,21 @@ void RecordShieldsSettingChanged(PrefService* local_state) {
       ::brave_shields::kChangedPerSiteShields, local_state);
 }
 
+void DispatchBufferedBlockedEvents(
+    const BlockedEventBuffer::Frame& frame,
+    const std::vector<BlockedEventBuffer::Event>& events) {
+  BraveShieldsWebContentsObserver::DispatchBlockedEvents(frame, events);
+
+#if BUILDFLAG(ENABLE_BRAVE_PERF_PREDICTOR)
+  std::vector<std::string> subresources;
+  subresources.reserve(events.size());
+  for (const auto& event : events)
+    subresources.push_back(event.subresource);
+  brave_perf_predictor::PerfPredictorTabHelper::DispatchBlockedEvents(
+      subresources, frame.render_process_id, frame.render_frame_id,
+      frame.frame_tree_node_id);
+#endif
+}
 
 ContentSetting GetDefaultAllowFromControlType(ControlType type) {
   if (type == ControlType::DEFAULT)
@@ -397,21 +417,20 @@ ControlType GetNoScriptControlType(HostContentSettingsMap* map,
                                           : ControlType::BLOCK;
 }
 
+BlockedEventBuffer* GetBlockedEventBuffer() {
+  static base::NoDestructor<BlockedEventBuffer> buffer(
+      base::BindRepeating(&DispatchBufferedBlockedEvents));
+  return buffer.get();
+}
+
 void DispatchBlockedEvent(const GURL& request_url,
                           int render_frame_id,
                           int render_process_id,
                           int frame_tree_node_id,
                           const std::string& block_type) {
-  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  BraveShieldsWebContentsObserver::DispatchBlockedEvent(
-      block_type, request_url.spec(),
-      render_process_id, render_frame_id, frame_tree_node_id);
-
-#if BUILDFLAG(ENABLE_BRAVE_PERF_PREDICTOR)
-  brave_perf_predictor::PerfPredictorTabHelper::DispatchBlockedEvent(
-      request_url.spec(), render_process_id,
-      render_frame_id, frame_tree_node_id);
-#endif
+  GetBlockedEventBuffer()->Add(
+      {render_process_id, render_frame_id, frame_tree_node_id},
+      {block_type, request_url.spec()});
 }
 
 bool IsSameOriginNavigation(const GURL& referrer, const GURL& target_url) {
@@ -23,6 +23,8 @@ class PrefService;
 
 namespace brave_shields {
 
+class BlockedEventBuffer;
+
 enum ControlType { ALLOW = 0, BLOCK, BLOCK_THIRD_PARTY, DEFAULT, INVALID };
 
 ContentSettingsPattern GetPatternFromURL(const GURL& url);
@@ -87,6 +89,11 @@ void SetNoScriptControlType(HostContentSettingsMap* map,
 ControlType GetNoScriptControlType(HostContentSettingsMap* map,
                                    const GURL& url);
 
+// Buffers the blocked events reported by DispatchBlockedEvent().
+BlockedEventBuffer* GetBlockedEventBuffer();
+
+// Can be called on any thread. The event reaches the shields panel and the
+// blocked counters once the buffer is flushed on the UI thread.
 void DispatchBlockedEvent(const GURL& request_url,
                           int render_frame_id,
                           int render_process_id,
@@ -221,41 +221,53 @@ void BraveShieldsWebContentsObserver::AddBlockedSubresource(
 }
 
 // static
-void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
-    std::string block_type,
-    std::string subresource,
-    int render_process_id,
-    int render_frame_id,
-    int frame_tree_node_id) {
+void BraveShieldsWebContentsObserver::DispatchBlockedEvents(
+    const BlockedEventBuffer::Frame& frame,
+    const std::vector<BlockedEventBuffer::Event>& events) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
-  WebContents* web_contents = GetWebContents(render_process_id,
-    render_frame_id, frame_tree_node_id);
-  DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
+  WebContents* web_contents = GetWebContents(frame.render_process_id,
+    frame.render_frame_id, frame.frame_tree_node_id);
+  if (!web_contents) {
+    return;
+  }
 
-  if (web_contents) {
-    BraveShieldsWebContentsObserver* observer =
-        BraveShieldsWebContentsObserver::FromWebContents(web_contents);
-    if (observer &&
-        !observer->IsBlockedSubresource(subresource)) {
-      observer->AddBlockedSubresource(subresource);
-      PrefService* prefs = Profile::FromBrowserContext(
-          web_contents->GetBrowserContext())->
-          GetOriginalProfile()->
-          GetPrefs();
-
-      if (block_type == kAds) {
-        prefs->SetUint64(kAdsBlocked, prefs->GetUint64(kAdsBlocked) + 1);
-      } else if (block_type == kHTTPUpgradableResources) {
-        prefs->SetUint64(kHttpsUpgrades, prefs->GetUint64(kHttpsUpgrades) + 1);
-      } else if (block_type == kJavaScript) {
-        prefs->SetUint64(kJavascriptBlocked,
-            prefs->GetUint64(kJavascriptBlocked) + 1);
-      } else if (block_type == kFingerprintingV2) {
-        prefs->SetUint64(kFingerprintingBlocked,
-            prefs->GetUint64(kFingerprintingBlocked) + 1);
-      }
+  for (const auto& event : events) {
+    DispatchBlockedEventForWebContents(event.block_type, event.subresource,
+                                       web_contents);
+  }
+
+  BraveShieldsWebContentsObserver* observer =
+      BraveShieldsWebContentsObserver::FromWebContents(web_contents);
+  if (!observer) {
+    return;
+  }
+
+  std::map<std::string, uint64_t> blocked_counts;
+  for (const auto& event : events) {
+    if (observer->IsBlockedSubresource(event.subresource)) {
+      continue;
     }
+    observer->AddBlockedSubresource(event.subresource);
+
+    if (event.block_type == kAds) {
+      ++blocked_counts[kAdsBlocked];
+    } else if (event.block_type == kHTTPUpgradableResources) {
+      ++blocked_counts[kHttpsUpgrades];
+    } else if (event.block_type == kJavaScript) {
+      ++blocked_counts[kJavascriptBlocked];
+    } else if (event.block_type == kFingerprintingV2) {
+      ++blocked_counts[kFingerprintingBlocked];
+    }
+  }
+
+  PrefService* prefs = Profile::FromBrowserContext(
+      web_contents->GetBrowserContext())->
+      GetOriginalProfile()->
+      GetPrefs();
+  for (const auto& blocked_count : blocked_counts) {
+    prefs->SetUint64(blocked_count.first,
+        prefs->GetUint64(blocked_count.first) + blocked_count.second);
   }
 }
 
@@ -343,6 +355,8 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
   content::ReloadType reload_type = navigation_handle->GetReloadType();
   if (navigation_handle->IsInMainFrame() &&
       !navigation_handle->IsSameDocument()) {
+    // Count what the previous page blocked before forgetting its URLs.
+    GetBlockedEventBuffer()->Flush();
     if (reload_type == content::ReloadType::NONE) {
       // For new loads, we reset the counters for both blocked scripts and URLs.
       allowed_script_origins_.clear();
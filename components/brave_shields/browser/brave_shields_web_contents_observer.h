@@ -14,6 +14,7 @@
 #include "base/macros.h"
 #include "base/synchronization/lock.h"
 #include "base/strings/string16.h"
+#include "brave/components/brave_shields/browser/blocked_event_buffer.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -36,11 +37,11 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
       const std::string& block_type,
       const std::string& subresource,
       content::WebContents* web_contents);
-  static void DispatchBlockedEvent(
-      std::string block_type,
-      std::string subresource,
-      int render_process_id,
-      int render_frame_id, int frame_tree_node_id);
+  // Reports the events buffered for a frame, updating the blocked counters
+  // with a single pref write per block type.
+  static void DispatchBlockedEvents(
+      const BlockedEventBuffer::Frame& frame,
+      const std::vector<BlockedEventBuffer::Event>& events);
   static GURL GetTabURLFromRenderFrameInfo(int render_process_id,
                                            int render_frame_id,
                                            int render_frame_tree_node_id);
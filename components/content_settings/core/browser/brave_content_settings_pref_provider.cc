@@ -6,9 +6,12 @@
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
 #include <memory>
+#include <set>
+#include <tuple>
 #include <utility>
 
 #include "base/bind.h"
+#include "base/no_destructor.h"
 #include "base/optional.h"
 #include "base/task/post_task.h"
 #include "brave/common/network_constants.h"
@@ -40,6 +43,12 @@ const char kSessionModelPath[] = "model";
 const char kSettingPath[] = "setting";
 const char kPerResourcePath[] = "per_resource";
 
+const ContentSettingsPattern& FirstPartyPattern() {
+  static const base::NoDestructor<ContentSettingsPattern> first_party_pattern(
+      ContentSettingsPattern::FromString("https://firstParty/*"));
+  return *first_party_pattern;
+}
+
 Rule CloneRule(const Rule& rule, bool reverse_patterns = false) {
   // brave plugin rules incorrectly use first party url as primary
   auto primary_pattern = reverse_patterns ? rule.secondary_pattern
@@ -47,8 +56,7 @@ Rule CloneRule(const Rule& rule, bool reverse_patterns = false) {
   auto secondary_pattern = reverse_patterns ? rule.primary_pattern
                                             : rule.secondary_pattern;
 
-  if (primary_pattern ==
-      ContentSettingsPattern::FromString("https://firstParty/*")) {
+  if (primary_pattern == FirstPartyPattern()) {
     DCHECK(reverse_patterns);  // we should only hit this for brave plugin rules
     if (!secondary_pattern.MatchesAllHosts()) {
       primary_pattern = ContentSettingsPattern::FromString(
@@ -78,41 +86,45 @@ class BraveShieldsRuleIterator : public RuleIterator {
   }
 
   Rule Next() override {
-    return CloneRule(*(iterator_++));
+    return std::move(*(iterator_++));
   }
 
  private:
   std::vector<Rule> rules_;
-  std::vector<Rule>::const_iterator iterator_;
+  std::vector<Rule>::iterator iterator_;
 
   DISALLOW_COPY_AND_ASSIGN(BraveShieldsRuleIterator);
 };
 
 
 bool IsActive(const Rule& cookie_rule,
-              const std::vector<Rule>& shield_rules) {
+              const BraveRuleIndex& shield_rules) {
   // don't include default rules in the iterator
   if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
       (cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
-       cookie_rule.secondary_pattern ==
-          ContentSettingsPattern::FromString("https://firstParty/*"))) {
+       cookie_rule.secondary_pattern == FirstPartyPattern())) {
     return false;
   }
 
-  bool default_value = true;
-  for (const auto& shield_rule : shield_rules) {
-    auto primary_compare =
-        shield_rule.primary_pattern.Compare(cookie_rule.primary_pattern);
-    // TODO(bridiver) - verify that SUCCESSOR is correct and not PREDECESSOR
-    if (primary_compare == ContentSettingsPattern::IDENTITY ||
-        primary_compare == ContentSettingsPattern::SUCCESSOR) {
-      // TODO(bridiver) - move this logic into shields_util for allow/block
-      return
-          ValueToContentSetting(&shield_rule.value) != CONTENT_SETTING_BLOCK;
-    }
-  }
+  // TODO(bridiver) - verify that SUCCESSOR is correct and not PREDECESSOR
+  const Rule* shield_rule =
+      shield_rules.FindIdentityOrSuccessor(cookie_rule.primary_pattern);
+  if (!shield_rule)
+    return true;
 
-  return default_value;
+  // TODO(bridiver) - move this logic into shields_util for allow/block
+  return ValueToContentSetting(&shield_rule->value) != CONTENT_SETTING_BLOCK;
+}
+
+std::vector<Rule> ReadRules(const PrefProvider* provider,
+                            ContentSettingsType content_type,
+                            bool incognito) {
+  std::vector<Rule> rules;
+  auto iterator = provider->PrefProvider::GetRuleIterator(content_type,
+                                                          incognito);
+  while (iterator && iterator->HasNext())
+    rules.emplace_back(iterator->Next());
+  return rules;
 }
 
 }  // namespace
@@ -155,6 +167,17 @@ BravePrefProvider::BravePrefProvider(PrefService* prefs,
 
 BravePrefProvider::~BravePrefProvider() {}
 
+BravePrefProvider::CookieRuleSources::CookieRuleSources() = default;
+
+BravePrefProvider::CookieRuleSources::CookieRuleSources(
+    CookieRuleSources&& other) = default;
+
+BravePrefProvider::CookieRuleSources&
+BravePrefProvider::CookieRuleSources::operator=(CookieRuleSources&& other) =
+    default;
+
+BravePrefProvider::CookieRuleSources::~CookieRuleSources() = default;
+
 void BravePrefProvider::ShutdownOnUIThread() {
   RemoveObserver(this);
   PrefProvider::ShutdownOnUIThread();
@@ -426,11 +449,10 @@ std::unique_ptr<RuleIterator> BravePrefProvider::GetRuleIterator(
       bool incognito) const {
   if (content_type == ContentSettingsType::COOKIES) {
     std::vector<Rule> rules;
-    for (auto i = cookie_rules_.at(incognito).begin();
-         i != cookie_rules_.at(incognito).end();
-         ++i) {
-      rules.emplace_back(CloneRule(*i));
-    }
+    const auto& cookie_rules = cookie_rules_.at(incognito);
+    rules.reserve(cookie_rules.size());
+    for (const auto& rule : cookie_rules)
+      rules.emplace_back(CloneRule(rule));
 
     return std::make_unique<BraveShieldsRuleIterator>(std::move(rules));
   }
@@ -442,6 +464,22 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
                                           bool incognito) {
   auto& rules = cookie_rules_[incognito];
   auto old_rules = std::move(brave_cookie_rules_[incognito]);
+  auto& sources = cookie_rule_sources_[incognito];
+
+  // Only re-read the rules of the type that changed.
+  if (!sources.loaded || content_type == ContentSettingsType::COOKIES) {
+    sources.chromium_cookie_rules =
+        ReadRules(this, ContentSettingsType::COOKIES, incognito);
+  }
+  if (!sources.loaded || content_type == ContentSettingsType::BRAVE_COOKIES) {
+    sources.brave_cookie_rules =
+        ReadRules(this, ContentSettingsType::BRAVE_COOKIES, incognito);
+  }
+  if (!sources.loaded || content_type == ContentSettingsType::BRAVE_SHIELDS) {
+    sources.shield_rules = BraveRuleIndex(
+        ReadRules(this, ContentSettingsType::BRAVE_SHIELDS, incognito));
+  }
+  sources.loaded = true;
 
   rules.clear();
   brave_cookie_rules_[incognito].clear();
@@ -479,40 +517,19 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   // chromium_src override
 
   // add chromium cookies
-  auto chromium_cookies_iterator = PrefProvider::GetRuleIterator(
-      ContentSettingsType::COOKIES,
-      incognito);
-  while (chromium_cookies_iterator && chromium_cookies_iterator->HasNext()) {
-    rules.emplace_back(CloneRule(chromium_cookies_iterator->Next()));
-  }
-  chromium_cookies_iterator.reset();
-
-  auto brave_shields_iterator = PrefProvider::GetRuleIterator(
-      ContentSettingsType::BRAVE_SHIELDS, incognito);
-
-  // collect shield rules
-  std::vector<Rule> shield_rules;
-  while (brave_shields_iterator && brave_shields_iterator->HasNext()) {
-    shield_rules.emplace_back(CloneRule(brave_shields_iterator->Next()));
-  }
-
-  brave_shields_iterator.reset();
+  for (const auto& rule : sources.chromium_cookie_rules)
+    rules.emplace_back(CloneRule(rule));
 
   // add brave cookies after checking shield status
-  auto brave_cookies_iterator = PrefProvider::GetRuleIterator(
-      ContentSettingsType::BRAVE_COOKIES, incognito);
-
-  // Matching cookie rules against shield rules.
-  while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
-    auto rule = brave_cookies_iterator->Next();
-    if (IsActive(rule, shield_rules)) {
+  for (const auto& rule : sources.brave_cookie_rules) {
+    if (IsActive(rule, sources.shield_rules)) {
       rules.emplace_back(CloneRule(rule, true));
       brave_cookie_rules_[incognito].emplace_back(CloneRule(rule, true));
     }
   }
 
   // Adding shields down rules (they always override cookie rules).
-  for (const auto& shield_rule : shield_rules) {
+  for (const auto& shield_rule : sources.shield_rules.rules()) {
     // There is no global shields rule
     if (shield_rule.primary_pattern.MatchesAllHosts())
       NOTREACHED();
@@ -535,36 +552,33 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   }
 
   // get the list of changes
+  // we want an exact match here because any change to the rule is an update
+  std::set<std::tuple<ContentSettingsPattern, ContentSettingsPattern,
+                      ContentSetting>>
+      old_settings;
+  for (const auto& old_rule : old_rules) {
+    old_settings.emplace(old_rule.primary_pattern, old_rule.secondary_pattern,
+                         ValueToContentSetting(&old_rule.value));
+  }
+
   std::vector<Rule> brave_cookie_updates;
+  std::set<std::pair<ContentSettingsPattern, ContentSettingsPattern>>
+      new_patterns;
   for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match = std::find_if(
-        old_rules.begin(),
-        old_rules.end(),
-        [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(&new_rule.value) ==
-                    ValueToContentSetting(&old_rule.value);
-        });
-    if (match == old_rules.end()) {
+    new_patterns.emplace(new_rule.primary_pattern, new_rule.secondary_pattern);
+    if (!old_settings.count(std::make_tuple(
+            new_rule.primary_pattern, new_rule.secondary_pattern,
+            ValueToContentSetting(&new_rule.value)))) {
       brave_cookie_updates.emplace_back(CloneRule(new_rule));
     }
   }
 
   // find any removed rules
+  // we only care about the patterns here because we're looking for deleted
+  // rules, not changed rules
   for (const auto& old_rule : old_rules) {
-    auto match = std::find_if(
-        brave_cookie_rules_[incognito].begin(),
-        brave_cookie_rules_[incognito].end(),
-        [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
+    if (!new_patterns.count(std::make_pair(old_rule.primary_pattern,
+                                           old_rule.secondary_pattern))) {
       brave_cookie_updates.emplace_back(
           Rule(old_rule.primary_pattern, old_rule.secondary_pattern,
                base::Value(), old_rule.expiration, old_rule.session_model));
@@ -586,10 +600,14 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
 
 void BravePrefProvider::NotifyChanges(const std::vector<Rule>& rules,
                                       bool incognito) {
+  // These notifications come back to OnContentSettingChanged, but they don't
+  // change the chromium cookie rules so there is nothing to update.
+  notifying_cookie_changes_ = true;
   for (const auto& rule : rules) {
     Notify(rule.primary_pattern, rule.secondary_pattern,
            ContentSettingsType::COOKIES);
   }
+  notifying_cookie_changes_ = false;
 }
 
 void BravePrefProvider::OnCookiePrefsChanged(
@@ -607,6 +625,11 @@ void BravePrefProvider::OnContentSettingChanged(
     const ContentSettingsPattern& primary_pattern,
     const ContentSettingsPattern& secondary_pattern,
     ContentSettingsType content_type) {
+  if (notifying_cookie_changes_ &&
+      content_type == ContentSettingsType::COOKIES) {
+    return;
+  }
+
   if (content_type == ContentSettingsType::COOKIES ||
       content_type == ContentSettingsType::BRAVE_COOKIES ||
       content_type == ContentSettingsType::BRAVE_SHIELDS) {
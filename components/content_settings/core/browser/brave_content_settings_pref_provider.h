@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
 #include "components/content_settings/core/browser/content_settings_observer.h"
 #include "components/content_settings/core/browser/content_settings_pref_provider.h"
 #include "components/prefs/pref_change_registrar.h"
@@ -51,6 +52,21 @@ class BravePrefProvider : public PrefProvider,
                            TestShieldsSettingsMigrationFromResourceIDs);
   FRIEND_TEST_ALL_PREFIXES(BravePrefProviderTest,
                            TestShieldsSettingsMigrationFromUnknownSettings);
+
+  // The rules the cookie rules are built from, cached per content type so
+  // that a change to one type doesn't re-read the others.
+  struct CookieRuleSources {
+    CookieRuleSources();
+    CookieRuleSources(CookieRuleSources&& other);
+    CookieRuleSources& operator=(CookieRuleSources&& other);
+    ~CookieRuleSources();
+
+    bool loaded = false;
+    std::vector<Rule> chromium_cookie_rules;
+    std::vector<Rule> brave_cookie_rules;
+    BraveRuleIndex shield_rules;
+  };
+
   void MigrateShieldsSettings(bool incognito);
   void MigrateShieldsSettingsFromResourceIds();
   void MigrateShieldsSettingsFromResourceIdsForOneType(
@@ -80,6 +96,9 @@ class BravePrefProvider : public PrefProvider,
 
   std::map<bool /* is_incognito */, std::vector<Rule>> cookie_rules_;
   std::map<bool /* is_incognito */, std::vector<Rule>> brave_cookie_rules_;
+  std::map<bool /* is_incognito */, CookieRuleSources> cookie_rule_sources_;
+  // True while NotifyChanges reports the cookie rules built here.
+  bool notifying_cookie_changes_ = false;
 
   bool initialized_;
   bool store_last_modified_;
@@ -524,4 +524,44 @@ TEST_F(BravePrefProviderTest, TestShieldsSettingsMigrationFromUnknownSettings) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, ShieldsDownOverridesCookieRules) {
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+
+  const GURL first_party_url("https://www.brave.com");
+  const GURL third_party_url("https://tracker.com");
+
+  // Block all cookies on the site.
+  provider.SetWebsiteSetting(
+      ContentSettingsPattern::FromString("https://www.brave.com/*"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::BRAVE_COOKIES,
+      ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party_url,
+                                         first_party_url,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields down for the whole domain turns the cookie rule off.
+  provider.SetWebsiteSetting(ContentSettingsPattern::FromString("[*.]brave.com"),
+                             ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, third_party_url,
+                                         first_party_url,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields up again.
+  provider.SetWebsiteSetting(ContentSettingsPattern::FromString("[*.]brave.com"),
+                             ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS, nullptr, {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party_url,
+                                         first_party_url,
+                                         ContentSettingsType::COOKIES, false));
+
+  provider.ShutdownOnUIThread();
+}
+
 }  //  namespace content_settings
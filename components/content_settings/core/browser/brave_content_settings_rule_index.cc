@@ -0,0 +1,93 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace content_settings {
+
+namespace {
+
+bool IsIdentityOrSuccessor(const Rule& rule,
+                           const ContentSettingsPattern& pattern) {
+  const auto relation = rule.primary_pattern.Compare(pattern);
+  return relation == ContentSettingsPattern::IDENTITY ||
+         relation == ContentSettingsPattern::SUCCESSOR;
+}
+
+void AppendPositions(const std::unordered_map<std::string,
+                                              std::vector<size_t>>& positions,
+                     const std::string& host,
+                     std::vector<size_t>* candidates) {
+  const auto it = positions.find(host);
+  if (it == positions.end())
+    return;
+
+  candidates->insert(candidates->end(), it->second.begin(), it->second.end());
+}
+
+}  // namespace
+
+BraveRuleIndex::BraveRuleIndex() = default;
+
+BraveRuleIndex::BraveRuleIndex(std::vector<Rule> rules)
+    : rules_(std::move(rules)) {
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    const auto& pattern = rules_[i].primary_pattern;
+    const std::string& host = pattern.GetHost();
+    if (host.empty()) {
+      other_rules_.push_back(i);
+    } else if (pattern.HasDomainWildcard()) {
+      domain_wildcards_[host].push_back(i);
+    } else {
+      exact_hosts_[host].push_back(i);
+    }
+  }
+}
+
+BraveRuleIndex::BraveRuleIndex(BraveRuleIndex&& other) = default;
+
+BraveRuleIndex& BraveRuleIndex::operator=(BraveRuleIndex&& other) = default;
+
+BraveRuleIndex::~BraveRuleIndex() = default;
+
+const Rule* BraveRuleIndex::FindIdentityOrSuccessor(
+    const ContentSettingsPattern& pattern) const {
+  const std::string& host = pattern.GetHost();
+  if (host.empty()) {
+    // Patterns without a host aren't worth indexing, they are rare.
+    for (const auto& rule : rules_) {
+      if (IsIdentityOrSuccessor(rule, pattern))
+        return &rule;
+    }
+    return nullptr;
+  }
+
+  // A rule can only be identical to or a successor of |pattern| if its host is
+  // the same, if it is a domain wildcard for the host or one of its parent
+  // domains, or if it has no host at all.
+  std::vector<size_t> candidates = other_rules_;
+  AppendPositions(exact_hosts_, host, &candidates);
+  std::string domain = host;
+  while (true) {
+    AppendPositions(domain_wildcards_, domain, &candidates);
+    const size_t dot = domain.find('.');
+    if (dot == std::string::npos)
+      break;
+    domain = domain.substr(dot + 1);
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  for (const size_t candidate : candidates) {
+    if (IsIdentityOrSuccessor(rules_[candidate], pattern))
+      return &rules_[candidate];
+  }
+
+  return nullptr;
+}
+
+}  // namespace content_settings
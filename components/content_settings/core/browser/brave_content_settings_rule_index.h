@@ -0,0 +1,56 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_RULE_INDEX_H_
+#define BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_RULE_INDEX_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "components/content_settings/core/browser/content_settings_rule.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+
+namespace content_settings {
+
+// Indexes rules by the host of their primary pattern, so that the rules whose
+// primary pattern overlaps a given pattern can be found without comparing it
+// against every rule. Rules with an exact host are kept in one map, rules with
+// a domain wildcard ("[*.]example.com") in another one that is probed with
+// every parent domain of the looked up host. Only the remaining rules, e.g.
+// ones without a host, are compared one by one.
+class BraveRuleIndex {
+ public:
+  BraveRuleIndex();
+  explicit BraveRuleIndex(std::vector<Rule> rules);
+  BraveRuleIndex(BraveRuleIndex&& other);
+  BraveRuleIndex& operator=(BraveRuleIndex&& other);
+  ~BraveRuleIndex();
+
+  // Returns the first rule, in the order the rules were given, whose primary
+  // pattern is identical to |pattern| or a successor of it, as defined by
+  // ContentSettingsPattern::Compare. Returns null if there is none.
+  const Rule* FindIdentityOrSuccessor(
+      const ContentSettingsPattern& pattern) const;
+
+  const std::vector<Rule>& rules() const { return rules_; }
+
+ private:
+  using RulePositions = std::unordered_map<std::string, std::vector<size_t>>;
+
+  std::vector<Rule> rules_;
+  RulePositions exact_hosts_;
+  RulePositions domain_wildcards_;
+  std::vector<size_t> other_rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(BraveRuleIndex);
+};
+
+}  // namespace content_settings
+
+#endif  // BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_RULE_INDEX_H_
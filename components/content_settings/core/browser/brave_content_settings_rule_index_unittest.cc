@@ -0,0 +1,116 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/values.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace content_settings {
+
+namespace {
+
+Rule CreateRule(const std::string& primary_pattern, int value) {
+  return Rule(ContentSettingsPattern::FromString(primary_pattern),
+              ContentSettingsPattern::Wildcard(), base::Value(value),
+              base::Time(), SessionModel::Durable);
+}
+
+// Reference implementation the index must agree with.
+const Rule* FindLinear(const std::vector<Rule>& rules,
+                       const ContentSettingsPattern& pattern) {
+  for (const auto& rule : rules) {
+    const auto relation = rule.primary_pattern.Compare(pattern);
+    if (relation == ContentSettingsPattern::IDENTITY ||
+        relation == ContentSettingsPattern::SUCCESSOR) {
+      return &rule;
+    }
+  }
+  return nullptr;
+}
+
+std::vector<Rule> CreateRules() {
+  std::vector<Rule> rules;
+  rules.push_back(CreateRule("https://www.brave.com:443/*", 1));
+  rules.push_back(CreateRule("[*.]brave.com", 2));
+  rules.push_back(CreateRule("www.example.com", 3));
+  rules.push_back(CreateRule("[*.]com", 4));
+  rules.push_back(CreateRule("[*.]example.org", 5));
+  return rules;
+}
+
+}  // namespace
+
+TEST(BraveRuleIndexTest, FindsFirstOverlappingRule) {
+  BraveRuleIndex index(CreateRules());
+
+  const Rule* rule = index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("https://www.brave.com:443/*"));
+  ASSERT_TRUE(rule);
+  EXPECT_EQ(1, rule->value.GetInt());
+
+  // Domain wildcards match subdomains.
+  rule = index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("search.brave.com"));
+  ASSERT_TRUE(rule);
+  EXPECT_EQ(2, rule->value.GetInt());
+
+  rule = index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("[*.]sub.example.org"));
+  ASSERT_TRUE(rule);
+  EXPECT_EQ(5, rule->value.GetInt());
+
+  rule = index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("example.com"));
+  ASSERT_TRUE(rule);
+  EXPECT_EQ(4, rule->value.GetInt());
+
+  // A more specific rule is not a successor.
+  EXPECT_FALSE(index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("[*.]org")));
+  EXPECT_FALSE(index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("brave.org")));
+}
+
+TEST(BraveRuleIndexTest, MatchesLinearScan) {
+  std::vector<Rule> rules = CreateRules();
+  rules.push_back(CreateRule("http://*:8080/*", 6));
+  std::vector<Rule> indexed_rules = CreateRules();
+  indexed_rules.push_back(CreateRule("http://*:8080/*", 6));
+  BraveRuleIndex index(std::move(indexed_rules));
+
+  for (const auto* pattern_string :
+       {"https://www.brave.com:443/*", "http://www.brave.com/*", "brave.com",
+        "[*.]brave.com", "www.example.com", "https://www.example.com:8080/*",
+        "example.com", "[*.]example.org", "a.b.example.org", "http://*:8080/*",
+        "https://[*.]brave.com/*", "*", "file:///tmp/index.html",
+        "192.168.0.1", "brave.org"}) {
+    const auto pattern = ContentSettingsPattern::FromString(pattern_string);
+    ASSERT_TRUE(pattern.IsValid()) << pattern_string;
+
+    const Rule* expected = FindLinear(rules, pattern);
+    const Rule* actual = index.FindIdentityOrSuccessor(pattern);
+    if (!expected) {
+      EXPECT_FALSE(actual) << pattern_string;
+      continue;
+    }
+
+    ASSERT_TRUE(actual) << pattern_string;
+    EXPECT_EQ(expected->value, actual->value) << pattern_string;
+  }
+}
+
+TEST(BraveRuleIndexTest, Empty) {
+  BraveRuleIndex index;
+  EXPECT_TRUE(index.rules().empty());
+  EXPECT_FALSE(index.FindIdentityOrSuccessor(
+      ContentSettingsPattern::FromString("brave.com")));
+}
+
+}  // namespace content_settings
@@ -7,15 +7,77 @@
 
 #include <utility>
 
-#include "base/json/json_reader.h"
 #include "base/optional.h"
 #include "base/values.h"
+#include "brave/components/brave_shields/browser/ad_block_engine_snapshot.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/cosmetic_filters/browser/url_cosmetic_resources_cache.h"
 #include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "url/gurl.h"
 
 namespace cosmetic_filters {
 
+namespace {
+
+std::vector<std::string> StringsFromList(const base::Value* list) {
+  std::vector<std::string> strings;
+  if (!list || !list->is_list())
+    return strings;
+
+  for (const auto& item : list->GetList()) {
+    if (item.is_string())
+      strings.push_back(item.GetString());
+  }
+  return strings;
+}
+
+mojom::UrlCosmeticResourcesPtr UrlCosmeticResourcesFromValue(
+    const base::Value& value) {
+  auto resources = mojom::UrlCosmeticResources::New();
+  resources->hide_selectors = StringsFromList(value.FindKey("hide_selectors"));
+  resources->force_hide_selectors =
+      StringsFromList(value.FindKey("force_hide_selectors"));
+  resources->exceptions = StringsFromList(value.FindKey("exceptions"));
+
+  const base::Value* style_selectors = value.FindDictKey("style_selectors");
+  if (style_selectors) {
+    for (const auto& item : style_selectors->DictItems()) {
+      resources->style_selectors[item.first] = StringsFromList(&item.second);
+    }
+  }
+
+  const std::string* injected_script = value.FindStringKey("injected_script");
+  if (injected_script)
+    resources->injected_script = *injected_script;
+  resources->generichide = value.FindBoolKey("generichide").value_or(false);
+
+  return resources;
+}
+
+// AdBlockService returns the selectors of the default and regional lists as
+// strings, followed by the selectors of the custom filters as a nested list.
+mojom::HiddenClassIdSelectorsPtr HiddenClassIdSelectorsFromValue(
+    const base::Value& value) {
+  auto selectors = mojom::HiddenClassIdSelectors::New();
+  if (!value.is_list())
+    return selectors;
+
+  for (const auto& item : value.GetList()) {
+    if (item.is_string()) {
+      selectors->hide_selectors.push_back(item.GetString());
+    } else if (item.is_list()) {
+      std::vector<std::string> custom_selectors = StringsFromList(&item);
+      selectors->force_hide_selectors.insert(
+          selectors->force_hide_selectors.end(), custom_selectors.begin(),
+          custom_selectors.end());
+    }
+  }
+  return selectors;
+}
+
+}  // namespace
+
 CosmeticFiltersResources::CosmeticFiltersResources(
     HostContentSettingsMap* settings_map,
     brave_shields::AdBlockService* ad_block_service)
@@ -26,44 +88,11 @@ CosmeticFiltersResources::CosmeticFiltersResources(
 CosmeticFiltersResources::~CosmeticFiltersResources() {}
 
 void CosmeticFiltersResources::HiddenClassIdSelectors(
-    const std::string& input,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions,
     HiddenClassIdSelectorsCallback callback) {
-  base::Optional<base::Value> input_value = base::JSONReader::Read(input);
-  if (!input_value || !input_value->is_dict()) {
-    // Nothing to work with
-    std::move(callback).Run(base::Value());
-
-    return;
-  }
-  base::DictionaryValue* input_dict;
-  if (!input_value->GetAsDictionary(&input_dict)) {
-    std::move(callback).Run(base::Value());
-
-    return;
-  }
-  std::vector<std::string> classes;
-  base::ListValue* classes_list;
-  if (input_dict->GetList("classes", &classes_list)) {
-    for (size_t i = 0; i < classes_list->GetSize(); i++) {
-      if (!classes_list->GetList()[i].is_string()) {
-        continue;
-      }
-      classes.push_back(classes_list->GetList()[i].GetString());
-    }
-  }
-  std::vector<std::string> ids;
-  base::ListValue* ids_list;
-  if (input_dict->GetList("ids", &ids_list)) {
-    for (size_t i = 0; i < ids_list->GetSize(); i++) {
-      if (!ids_list->GetList()[i].is_string()) {
-        continue;
-      }
-      ids.push_back(ids_list->GetList()[i].GetString());
-    }
-  }
-
-  ad_block_service_->GetTaskRunner()->PostTaskAndReplyWithResult(
+  ad_block_service_->GetMatchingTaskRunner()->PostTaskAndReplyWithResult(
       FROM_HERE,
       base::BindOnce(&brave_shields::AdBlockService::HiddenClassIdSelectors,
                      base::Unretained(ad_block_service_), classes, ids,
@@ -75,15 +104,27 @@ void CosmeticFiltersResources::HiddenClassIdSelectors(
 void CosmeticFiltersResources::HiddenClassIdSelectorsOnUI(
     HiddenClassIdSelectorsCallback callback,
     base::Optional<base::Value> resources) {
-  std::move(callback).Run(resources ? std::move(resources.value())
-                                    : base::Value());
+  if (!resources) {
+    std::move(callback).Run(mojom::HiddenClassIdSelectors::New());
+    return;
+  }
+  std::move(callback).Run(HiddenClassIdSelectorsFromValue(*resources));
 }
 
 void CosmeticFiltersResources::UrlCosmeticResourcesOnUI(
     UrlCosmeticResourcesCallback callback,
+    const std::string& host,
+    uint64_t rules_version,
     base::Optional<base::Value> resources) {
-  std::move(callback).Run(resources ? std::move(resources.value())
-                                    : base::Value());
+  if (!resources || !resources->is_dict()) {
+    std::move(callback).Run(nullptr);
+    return;
+  }
+
+  mojom::UrlCosmeticResourcesPtr result =
+      UrlCosmeticResourcesFromValue(*resources);
+  UrlCosmeticResourcesCache::GetInstance()->Put(host, rules_version, result);
+  std::move(callback).Run(std::move(result));
 }
 
 void CosmeticFiltersResources::ShouldDoCosmeticFiltering(
@@ -100,12 +141,25 @@ void CosmeticFiltersResources::ShouldDoCosmeticFiltering(
 void CosmeticFiltersResources::UrlCosmeticResources(
     const std::string& url,
     UrlCosmeticResourcesCallback callback) {
-  ad_block_service_->GetTaskRunner()->PostTaskAndReplyWithResult(
+  // Read before matching, so that a result computed while the rules change
+  // is cached against the old version.
+  const uint64_t rules_version =
+      brave_shields::AdBlockEngineSnapshot::GetRulesVersion();
+  const std::string host = GURL(url).host();
+  mojom::UrlCosmeticResourcesPtr cached =
+      UrlCosmeticResourcesCache::GetInstance()->Get(host, rules_version);
+  if (cached) {
+    std::move(callback).Run(std::move(cached));
+    return;
+  }
+
+  ad_block_service_->GetMatchingTaskRunner()->PostTaskAndReplyWithResult(
       FROM_HERE,
       base::BindOnce(&brave_shields::AdBlockService::UrlCosmeticResources,
                      base::Unretained(ad_block_service_), url),
       base::BindOnce(&CosmeticFiltersResources::UrlCosmeticResourcesOnUI,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_factory_.GetWeakPtr(), std::move(callback), host,
+                     rules_version));
 }
 
 }  // namespace cosmetic_filters
@@ -0,0 +1,57 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/cosmetic_filters/browser/url_cosmetic_resources_cache.h"
+
+#include <utility>
+
+#include "base/no_destructor.h"
+
+namespace cosmetic_filters {
+
+UrlCosmeticResourcesCache::Entry::Entry() = default;
+UrlCosmeticResourcesCache::Entry::Entry(Entry&& other) = default;
+UrlCosmeticResourcesCache::Entry& UrlCosmeticResourcesCache::Entry::operator=(
+    Entry&& other) = default;
+UrlCosmeticResourcesCache::Entry::~Entry() = default;
+
+UrlCosmeticResourcesCache::UrlCosmeticResourcesCache()
+    : entries_(kMaxEntries) {}
+
+UrlCosmeticResourcesCache::~UrlCosmeticResourcesCache() = default;
+
+// static
+UrlCosmeticResourcesCache* UrlCosmeticResourcesCache::GetInstance() {
+  static base::NoDestructor<UrlCosmeticResourcesCache> instance;
+  return instance.get();
+}
+
+mojom::UrlCosmeticResourcesPtr UrlCosmeticResourcesCache::Get(
+    const std::string& host,
+    uint64_t rules_version) {
+  auto it = entries_.Get(host);
+  if (it == entries_.end())
+    return nullptr;
+
+  if (it->second.rules_version != rules_version) {
+    entries_.Erase(it);
+    return nullptr;
+  }
+
+  return it->second.resources.Clone();
+}
+
+void UrlCosmeticResourcesCache::Put(
+    const std::string& host,
+    uint64_t rules_version,
+    const mojom::UrlCosmeticResourcesPtr& resources) {
+  DCHECK(resources);
+  Entry entry;
+  entry.rules_version = rules_version;
+  entry.resources = resources.Clone();
+  entries_.Put(host, std::move(entry));
+}
+
+}  // namespace cosmetic_filters
@@ -0,0 +1,59 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_COSMETIC_FILTERS_BROWSER_URL_COSMETIC_RESOURCES_CACHE_H_
+#define BRAVE_COMPONENTS_COSMETIC_FILTERS_BROWSER_URL_COSMETIC_RESOURCES_CACHE_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "base/containers/mru_cache.h"
+#include "base/macros.h"
+#include "brave/components/cosmetic_filters/common/cosmetic_filters.mojom.h"
+
+namespace cosmetic_filters {
+
+// Remembers the cosmetic resources computed for a host, so that frames of the
+// same site don't each run the adblock engines again. Cosmetic rules only
+// depend on the host of a URL. Entries are tied to the adblock rules version
+// they were computed with and are ignored once the rules change. Must be used
+// on the UI thread.
+class UrlCosmeticResourcesCache {
+ public:
+  static constexpr size_t kMaxEntries = 100;
+
+  UrlCosmeticResourcesCache();
+  ~UrlCosmeticResourcesCache();
+
+  static UrlCosmeticResourcesCache* GetInstance();
+
+  // Returns a copy of the resources cached for |host|, or null if there are
+  // none for |rules_version|.
+  mojom::UrlCosmeticResourcesPtr Get(const std::string& host,
+                                     uint64_t rules_version);
+  void Put(const std::string& host,
+           uint64_t rules_version,
+           const mojom::UrlCosmeticResourcesPtr& resources);
+
+ private:
+  struct Entry {
+    Entry();
+    Entry(Entry&& other);
+    Entry& operator=(Entry&& other);
+    ~Entry();
+
+    uint64_t rules_version = 0;
+    mojom::UrlCosmeticResourcesPtr resources;
+  };
+
+  base::MRUCache<std::string, Entry> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(UrlCosmeticResourcesCache);
+};
+
+}  // namespace cosmetic_filters
+
+#endif  // BRAVE_COMPONENTS_COSMETIC_FILTERS_BROWSER_URL_COSMETIC_RESOURCES_CACHE_H_
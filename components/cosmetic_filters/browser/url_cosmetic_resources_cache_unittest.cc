@@ -0,0 +1,46 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/cosmetic_filters/browser/url_cosmetic_resources_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace cosmetic_filters {
+
+namespace {
+
+mojom::UrlCosmeticResourcesPtr CreateResources(const std::string& selector) {
+  auto resources = mojom::UrlCosmeticResources::New();
+  resources->hide_selectors.push_back(selector);
+  return resources;
+}
+
+}  // namespace
+
+TEST(UrlCosmeticResourcesCacheTest, ReturnsCopyOfCachedResources) {
+  UrlCosmeticResourcesCache cache;
+  EXPECT_FALSE(cache.Get("example.com", 1));
+
+  auto resources = CreateResources(".ad");
+  cache.Put("example.com", 1, resources);
+  resources->hide_selectors.clear();
+
+  mojom::UrlCosmeticResourcesPtr cached = cache.Get("example.com", 1);
+  ASSERT_TRUE(cached);
+  ASSERT_EQ(1u, cached->hide_selectors.size());
+  EXPECT_EQ(".ad", cached->hide_selectors[0]);
+  EXPECT_FALSE(cache.Get("sub.example.com", 1));
+}
+
+TEST(UrlCosmeticResourcesCacheTest, IgnoresEntriesOfOtherRulesVersions) {
+  UrlCosmeticResourcesCache cache;
+  cache.Put("example.com", 1, CreateResources(".ad"));
+
+  EXPECT_FALSE(cache.Get("example.com", 2));
+  // The stale entry is gone even for its own version.
+  EXPECT_FALSE(cache.Get("example.com", 1));
+}
+
+}  // namespace cosmetic_filters
@@ -101,10 +101,7 @@ const fetchNewClassIdRules = () => {
   }
   // Callback to c++ renderer process
   // @ts-ignore
-  cf_worker.hiddenClassIdSelectors(
-      JSON.stringify({
-        classes: notYetQueriedClasses, ids: notYetQueriedIds
-      }))
+  cf_worker.hiddenClassIdSelectors(notYetQueriedClasses, notYetQueriedIds)
   notYetQueriedClasses = []
   notYetQueriedIds = []
 }
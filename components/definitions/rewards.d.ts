@@ -26,6 +26,7 @@ declare namespace Rewards {
     adsData: AdsData
     adsHistory: AdsHistory[]
     autoContributeList: Publisher[]
+    autoContributeListTotal?: number
     balance: Balance
     balanceReport?: BalanceReport
     contributeLoad: boolean
@@ -196,6 +197,18 @@ declare namespace Rewards {
     weight: number
   }
 
+  export interface ContributeListPage {
+    start: number
+    total: number
+    list: Publisher[]
+  }
+
+  export interface ContributeListDelta {
+    total: number
+    changed: Publisher[]
+    removed: string[]
+  }
+
   export interface ExcludedPublisher {
     id: string
     status: PublisherStatus
@@ -24,6 +24,9 @@ namespace ntp_background_images {
 
 namespace {
 
+// Enough for a full rotation of sponsored wallpapers and their logos.
+constexpr size_t kMaxImageCacheBytes = 16 * 1024 * 1024;
+
 base::Optional<std::string> ReadFileToString(const base::FilePath& path) {
   std::string contents;
   if (!base::ReadFileToString(path, &contents))
@@ -40,10 +43,52 @@ bool IsSuperReferralPath(const std::string& path) {
 NTPBackgroundImagesSource::NTPBackgroundImagesSource(
     NTPBackgroundImagesService* service)
     : service_(service),
+      observed_service_(service->GetWeakPtr()),
+      image_cache_(ImageCache::NO_AUTO_EVICT),
       weak_factory_(this) {
+  service_->AddObserver(this);
+}
+
+NTPBackgroundImagesSource::~NTPBackgroundImagesSource() {
+  if (observed_service_)
+    observed_service_->RemoveObserver(this);
+}
+
+void NTPBackgroundImagesSource::PrefetchBackground(bool super_referral,
+                                                   int index) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto* images_data = service_->GetBackgroundImagesData(super_referral);
+  if (!images_data || index < 0 ||
+      index >= static_cast<int>(images_data->backgrounds.size()))
+    return;
+
+  const auto& background = images_data->backgrounds[index];
+  if (image_cache_.Peek(background.image_file) == image_cache_.end())
+    ReadImageFile(background.image_file, GotDataCallback());
+
+  const base::FilePath& logo_file =
+      background.logo ? background.logo->image_file
+                      : images_data->default_logo.image_file;
+  if (!logo_file.empty() && image_cache_.Peek(logo_file) == image_cache_.end())
+    ReadImageFile(logo_file, GotDataCallback());
 }
 
-NTPBackgroundImagesSource::~NTPBackgroundImagesSource() = default;
+bool NTPBackgroundImagesSource::IsBackgroundCached(bool super_referral,
+                                                   int index) const {
+  auto* images_data = service_->GetBackgroundImagesData(super_referral);
+  if (!images_data || index < 0 ||
+      index >= static_cast<int>(images_data->backgrounds.size()))
+    return false;
+
+  return image_cache_.Peek(images_data->backgrounds[index].image_file) !=
+         image_cache_.end();
+}
+
+base::WeakPtr<NTPBackgroundImagesSource>
+NTPBackgroundImagesSource::AsWeakPtr() {
+  return weak_factory_.GetWeakPtr();
+}
 
 std::string NTPBackgroundImagesSource::GetSource() {
   return kBrandedWallpaperHost;
@@ -98,24 +143,93 @@ void NTPBackgroundImagesSource::StartDataRequest(
 void NTPBackgroundImagesSource::GetImageFile(
     const base::FilePath& image_file_path,
     GotDataCallback callback) {
+  auto cached = image_cache_.Get(image_file_path);
+  if (cached != image_cache_.end()) {
+    std::move(callback).Run(cached->second);
+    return;
+  }
+
+  ReadImageFile(image_file_path, std::move(callback));
+}
+
+void NTPBackgroundImagesSource::ReadImageFile(
+    const base::FilePath& image_file_path,
+    GotDataCallback callback) {
+  auto pending = pending_reads_.find(image_file_path);
+  const bool read_in_flight = pending != pending_reads_.end();
+  if (!read_in_flight) {
+    pending = pending_reads_.emplace(image_file_path,
+                                     std::vector<GotDataCallback>()).first;
+  }
+  if (callback)
+    pending->second.push_back(std::move(callback));
+
+  // Later requests for the same file just wait for the first read.
+  if (read_in_flight)
+    return;
+
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::ThreadPool(), base::MayBlock()},
       base::BindOnce(&ReadFileToString, image_file_path),
       base::BindOnce(&NTPBackgroundImagesSource::OnGotImageFile,
                      weak_factory_.GetWeakPtr(),
-                     std::move(callback)));
+                     image_file_path));
 }
 
 void NTPBackgroundImagesSource::OnGotImageFile(
-    GotDataCallback callback,
+    const base::FilePath& image_file_path,
     base::Optional<std::string> input) {
-  if (!input)
-    return;
+  auto pending = pending_reads_.find(image_file_path);
+  DCHECK(pending != pending_reads_.end());
+  std::vector<GotDataCallback> callbacks = std::move(pending->second);
+  pending_reads_.erase(pending);
 
   scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-       reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
-  std::move(callback).Run(std::move(bytes));
+  if (input) {
+    bytes = base::RefCountedString::TakeString(&input.value());
+    AddToImageCache(image_file_path, bytes);
+  }
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(bytes);
+}
+
+void NTPBackgroundImagesSource::AddToImageCache(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> bytes) {
+  if (bytes->size() > kMaxImageCacheBytes)
+    return;
+
+  auto existing = image_cache_.Peek(image_file_path);
+  if (existing != image_cache_.end()) {
+    image_cache_bytes_ -= existing->second->size();
+    image_cache_.Erase(existing);
+  }
+
+  image_cache_bytes_ += bytes->size();
+  image_cache_.Put(image_file_path, std::move(bytes));
+
+  // Evict least recently used images until we're within budget.
+  while (image_cache_bytes_ > kMaxImageCacheBytes) {
+    auto oldest = image_cache_.rbegin();
+    image_cache_bytes_ -= oldest->second->size();
+    image_cache_.Erase(oldest);
+  }
+}
+
+void NTPBackgroundImagesSource::ClearImageCache() {
+  image_cache_.Clear();
+  image_cache_bytes_ = 0;
+}
+
+void NTPBackgroundImagesSource::OnUpdated(NTPBackgroundImagesData* data) {
+  // Component updates install into a new directory, so cached files of the
+  // previous version won't be requested anymore.
+  ClearImageCache();
+}
+
+void NTPBackgroundImagesSource::OnSuperReferralEnded() {
+  ClearImageCache();
 }
 
 std::string NTPBackgroundImagesSource::GetMimeType(const std::string& path) {
@@ -7,21 +7,27 @@
 #define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_BACKGROUND_IMAGES_SOURCE_H_
 
 #include <string>
+#include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/mru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
 #include "base/optional.h"
+#include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "content/public/browser/url_data_source.h"
 
-namespace base {
-class FilePath;
-}  // namespace base
-
 namespace ntp_background_images {
 
-class NTPBackgroundImagesService;
+struct NTPBackgroundImagesData;
 
 // This serves background image data.
-class NTPBackgroundImagesSource : public content::URLDataSource {
+// Recently served and prefetched image files are kept in a bounded in-memory
+// cache so that opening several new tabs in a row doesn't read the same
+// wallpaper from disk each time.
+class NTPBackgroundImagesSource : public content::URLDataSource,
+                                  public NTPBackgroundImagesService::Observer {
  public:
   explicit NTPBackgroundImagesSource(NTPBackgroundImagesService* service);
 
@@ -31,10 +37,22 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   NTPBackgroundImagesSource& operator=(
       const NTPBackgroundImagesSource&) = delete;
 
+  // Reads the wallpaper at |index| and its logo into the cache ahead of a New
+  // Tab Page requesting them.
+  void PrefetchBackground(bool super_referral, int index);
+  // Returns true if the wallpaper at |index| can be served from the cache.
+  bool IsBackgroundCached(bool super_referral, int index) const;
+
+  base::WeakPtr<NTPBackgroundImagesSource> AsWeakPtr();
+
  private:
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, BasicTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BasicSuperReferralDataTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, ImageCacheTest);
+
+  using ImageCache =
+      base::MRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>;
 
   // content::URLDataSource overrides:
   std::string GetSource() override;
@@ -44,10 +62,21 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   std::string GetMimeType(const std::string& path) override;
   bool AllowCaching() override;
 
+  // NTPBackgroundImagesService::Observer overrides:
+  void OnUpdated(NTPBackgroundImagesData* data) override;
+  void OnSuperReferralEnded() override;
+
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
+  // Reads |image_file_path| into the cache and runs |callback|, if any, with
+  // its contents. Joins a read of the same file that is already in flight.
+  void ReadImageFile(const base::FilePath& image_file_path,
+                     GotDataCallback callback);
+  void OnGotImageFile(const base::FilePath& image_file_path,
                       base::Optional<std::string> input);
+  void AddToImageCache(const base::FilePath& image_file_path,
+                       scoped_refptr<base::RefCountedMemory> bytes);
+  void ClearImageCache();
   bool IsValidPath(const std::string& path) const;
   bool IsLogoPath(const std::string& path) const;
   bool IsDefaultLogoPath(const std::string& path) const;
@@ -58,6 +87,14 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   base::FilePath GetTopSiteFaviconFilePath(const std::string& path) const;
 
   NTPBackgroundImagesService* service_;  // not owned
+  // The data source is owned by the URLDataManager and can outlive the
+  // service, so it only unregisters as an observer while the service is alive.
+  base::WeakPtr<NTPBackgroundImagesService> observed_service_;
+  ImageCache image_cache_;
+  size_t image_cache_bytes_ = 0;
+  // Callbacks waiting for an image file read that is in flight. Prefetches
+  // register the path without any callback.
+  base::flat_map<base::FilePath, std::vector<GotDataCallback>> pending_reads_;
   base::WeakPtrFactory<NTPBackgroundImagesSource> weak_factory_;
 };
 
@@ -6,6 +6,11 @@
 #include <memory>
 #include <string>
 
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/run_loop.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_referrals/browser/brave_referrals_service.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
@@ -32,7 +37,7 @@ class NTPBackgroundImagesSourceTest : public testing::Test {
                     base::Value(base::Value::Type::DICTIONARY));
   }
 
-  base::test::SingleThreadTaskEnvironment task_environment;
+  base::test::TaskEnvironment task_environment;
   TestingPrefServiceSimple local_pref_;
   std::unique_ptr<NTPBackgroundImagesService> service_;
   std::unique_ptr<NTPBackgroundImagesSource> source_;
@@ -78,9 +83,54 @@ TEST_F(NTPBackgroundImagesSourceTest, BasicTest) {
       source_->GetWallpaperIndexFromPath("sponsored-images/wallpaper-3.jpg"));
 }
 
+TEST_F(NTPBackgroundImagesSourceTest, ImageCacheTest) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath image_path =
+      temp_dir.GetPath().AppendASCII("wallpaper-0.jpg");
+  ASSERT_TRUE(base::WriteFile(image_path, "wallpaper"));
+
+  auto get_image_file = [&]() {
+    std::string result;
+    base::RunLoop run_loop;
+    source_->GetImageFile(
+        image_path,
+        base::BindOnce(
+            [](std::string* result, base::OnceClosure quit,
+               scoped_refptr<base::RefCountedMemory> bytes) {
+              if (bytes)
+                result->assign(bytes->front_as<char>(), bytes->size());
+              std::move(quit).Run();
+            },
+            &result, run_loop.QuitClosure()));
+    run_loop.Run();
+    return result;
+  };
+
+  EXPECT_EQ("wallpaper", get_image_file());
+  EXPECT_EQ(1u, source_->image_cache_.size());
+  EXPECT_EQ(9u, source_->image_cache_bytes_);
+
+  // Served from the cache once read.
+  ASSERT_TRUE(base::DeleteFile(image_path));
+  EXPECT_EQ("wallpaper", get_image_file());
+
+  // Component updates drop cached files.
+  source_->OnUpdated(nullptr);
+  EXPECT_EQ(0u, source_->image_cache_.size());
+  EXPECT_EQ(0u, source_->image_cache_bytes_);
+  EXPECT_EQ("", get_image_file());
+}
+
 #if BUILDFLAG(ENABLE_BRAVE_REFERRALS)
 
 #if !defined(OS_LINUX)
+TEST_F(NTPBackgroundImagesSourceTest, ServiceDestroyedBeforeSource) {
+  EXPECT_TRUE(service_->HasObserver(source_.get()));
+  service_.reset();
+  source_.reset();
+}
+
 TEST_F(NTPBackgroundImagesSourceTest, BasicSuperReferralDataTest) {
   // Valid super referral component json data.
   const std::string test_json_string_referral = R"(
@@ -28,6 +28,9 @@ class ViewCounterModel {
   }
 
   bool ShouldShowBrandedWallpaper() const;
+  // Index of the wallpaper that will be shown the next time a branded
+  // wallpaper is displayed after the current page view.
+  int GetNextWallpaperImageIndex() const;
   void RegisterPageView();
   void ResetCurrentWallpaperImageIndex();
 
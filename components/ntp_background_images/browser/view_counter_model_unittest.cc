@@ -80,4 +80,27 @@ TEST(ViewCounterModelTest, NTPSuperReferralTest) {
   }
 }
 
+TEST(ViewCounterModelTest, NextWallpaperImageIndexTest) {
+  ViewCounterModel model;
+  model.set_total_image_count(kTestImageCount);
+
+  // Each branded wallpaper display is preceded by the index reported as next.
+  int expected_index = model.GetNextWallpaperImageIndex();
+  for (int i = 0; i < 20; ++i) {
+    model.RegisterPageView();
+    if (model.ShouldShowBrandedWallpaper()) {
+      EXPECT_EQ(expected_index, model.current_wallpaper_image_index());
+      expected_index = model.GetNextWallpaperImageIndex();
+    }
+  }
+
+  model.Reset();
+  model.set_ignore_count_to_branded_wallpaper(true);
+  model.set_total_image_count(kTestImageCount);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ((i + 1) % kTestImageCount, model.GetNextWallpaperImageIndex());
+    model.RegisterPageView();
+  }
+}
+
 }  // namespace ntp_background_images
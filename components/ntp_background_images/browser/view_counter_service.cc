@@ -20,6 +20,7 @@
 #include "brave/components/brave_rewards/common/pref_names.h"
 #include "brave/components/ntp_background_images/browser/features.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
+#include "brave/components/ntp_background_images/browser/ntp_background_images_source.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
 #include "brave/components/ntp_background_images/common/pref_names.h"
 #include "brave/components/weekly_storage/weekly_storage.h"
@@ -176,6 +177,8 @@ void ViewCounterService::OnUpdated(NTPBackgroundImagesData* data) {
     model_.ResetCurrentWallpaperImageIndex();
     model_.set_total_image_count(data->backgrounds.size());
     model_.set_ignore_count_to_branded_wallpaper(data->IsSuperReferral());
+    if (IsBrandedWallpaperActive())
+      PrefetchBackground(model_.current_wallpaper_image_index());
   }
 }
 
@@ -217,9 +220,35 @@ void ViewCounterService::RegisterPageView() {
   // or the user opt-in status changing.
   if (IsBrandedWallpaperActive()) {
     model_.RegisterPageView();
+    PrefetchBackground(model_.GetNextWallpaperImageIndex());
   }
 }
 
+void ViewCounterService::SetBackgroundImagesSource(
+    base::WeakPtr<NTPBackgroundImagesSource> source) {
+  images_source_ = source;
+  if (IsBrandedWallpaperActive())
+    PrefetchBackground(model_.current_wallpaper_image_index());
+}
+
+bool ViewCounterService::IsCurrentWallpaperCached() const {
+  if (!images_source_)
+    return false;
+
+  auto* data = GetCurrentBrandedWallpaperData();
+  return data &&
+         images_source_->IsBackgroundCached(
+             data->IsSuperReferral(), model_.current_wallpaper_image_index());
+}
+
+void ViewCounterService::PrefetchBackground(int index) {
+  if (!images_source_)
+    return;
+
+  if (auto* data = GetCurrentBrandedWallpaperData())
+    images_source_->PrefetchBackground(data->IsSuperReferral(), index);
+}
+
 void ViewCounterService::BrandedWallpaperLogoClicked(
     const std::string& creative_instance_id,
     const std::string& destination_url,
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
@@ -31,6 +32,7 @@ class WeeklyStorage;
 
 namespace ntp_background_images {
 
+class NTPBackgroundImagesSource;
 struct NTPBackgroundImagesData;
 struct TopSite;
 
@@ -77,6 +79,12 @@ class ViewCounterService : public KeyedService,
 
   void InitializeWebUIDataSource(content::WebUIDataSource* html_source);
 
+  // |source| is used to prefetch the wallpaper that will be shown next.
+  void SetBackgroundImagesSource(
+      base::WeakPtr<NTPBackgroundImagesSource> source);
+  // Returns true if the current wallpaper will be served from memory.
+  bool IsCurrentWallpaperCached() const;
+
  private:
   // Sync with themeValues in brave_appearance_page.js
   enum ThemesOption {
@@ -119,6 +127,7 @@ class ViewCounterService : public KeyedService,
   bool ShouldShowBrandedWallpaper() const;
 
   void ResetModel();
+  void PrefetchBackground(int index);
 
   void UpdateP3AValues() const;
 
@@ -128,6 +137,7 @@ class ViewCounterService : public KeyedService,
   bool is_supported_locale_ = false;
   PrefChangeRegistrar pref_change_registrar_;
   ViewCounterModel model_;
+  base::WeakPtr<NTPBackgroundImagesSource> images_source_;
 
   // If P3A is enabled, these will track number of tabs created
   // and the ratio of those which are branded images.
@@ -11,17 +11,35 @@
 
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "mojo/public/cpp/bindings/sync_call_restrictions.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/process/process_metrics.h"
+#include "base/strings/string_number_conversions.h"
+#include "build/build_config.h"
 
 namespace bat_ads {
 
 namespace {
 
+constexpr base::TimeDelta kReportCallCountsInterval =
+    base::TimeDelta::FromMinutes(1);
+
 ads::Result ToAdsResult(
     const int32_t result) {
   return (ads::Result)result;
 }
 
+size_t GetResidentSetSizeKB() {
+#if defined(OS_LINUX) || defined(OS_CHROMEOS) || defined(OS_ANDROID)
+  return base::ProcessMetrics::CreateCurrentProcessMetrics()
+             ->GetResidentSetSize() /
+         1024;
+#else
+  return 0;
+#endif
+}
+
 }  // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +47,40 @@ ads::Result ToAdsResult(
 BatAdsClientMojoBridge::BatAdsClientMojoBridge(
     mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info) {
   bat_ads_client_.Bind(std::move(client_info));
+
+  report_call_counts_timer_.Start(FROM_HERE, kReportCallCountsInterval, this,
+      &BatAdsClientMojoBridge::ReportCallCounts);
+}
+
+void BatAdsClientMojoBridge::OnPrefsChanged(
+    base::flat_map<std::string, base::Value> prefs) {
+  for (auto& pref : prefs) {
+    if (pending_writes_.count(pref.first)) {
+      continue;
+    }
+
+    prefs_[pref.first] = std::move(pref.second);
+  }
+}
+
+void BatAdsClientMojoBridge::OnPrefWritten(
+    const std::string& path,
+    base::Value value) {
+  const auto iter = pending_writes_.find(path);
+  if (iter != pending_writes_.end()) {
+    if (--iter->second > 0) {
+      return;
+    }
+
+    pending_writes_.erase(iter);
+  }
+
+  if (value.is_none()) {
+    prefs_.erase(path);
+    return;
+  }
+
+  prefs_[path] = std::move(value);
 }
 
 BatAdsClientMojoBridge::~BatAdsClientMojoBridge() = default;
@@ -38,6 +90,7 @@ bool BatAdsClientMojoBridge::CanShowBackgroundNotifications() const {
     return false;
 
   bool can_show;
+  ++sync_calls_;
   bat_ads_client_->CanShowBackgroundNotifications(&can_show);
   return can_show;
 }
@@ -48,6 +101,7 @@ bool BatAdsClientMojoBridge::IsNetworkConnectionAvailable() const {
   }
 
   bool is_available;
+  ++sync_calls_;
   bat_ads_client_->IsNetworkConnectionAvailable(&is_available);
   return is_available;
 }
@@ -58,6 +112,7 @@ bool BatAdsClientMojoBridge::IsForeground() const {
   }
 
   bool is_foreground;
+  ++sync_calls_;
   bat_ads_client_->IsForeground(&is_foreground);
   return is_foreground;
 }
@@ -68,6 +123,7 @@ bool BatAdsClientMojoBridge::IsFullScreen() const {
   }
 
   bool is_full_screen;
+  ++sync_calls_;
   bat_ads_client_->IsFullScreen(&is_full_screen);
   return is_full_screen;
 }
@@ -87,6 +143,7 @@ bool BatAdsClientMojoBridge::ShouldShowNotifications() {
   }
 
   bool should_show;
+  ++sync_calls_;
   bat_ads_client_->ShouldShowNotifications(&should_show);
   return should_show;
 }
@@ -154,9 +211,35 @@ void BatAdsClientMojoBridge::Save(
 
 void OnLoadUserModelForId(
     const ads::LoadCallback& callback,
+    const base::TimeTicks& start_time,
     const int32_t result,
-    const std::string& value) {
-  callback(ToAdsResult(result), value);
+    base::File file) {
+  if (ToAdsResult(result) != ads::Result::SUCCESS || !file.IsValid()) {
+    callback(ads::Result::FAILED, "");
+    return;
+  }
+
+  const size_t rss_before_kb = GetResidentSetSizeKB();
+
+  base::MemoryMappedFile mapped_file;
+  if (!mapped_file.Initialize(std::move(file)) || mapped_file.length() == 0) {
+    callback(ads::Result::FAILED, "");
+    return;
+  }
+
+  // The ads library parses user models from a string, so this is the only
+  // copy made of the mapped file. Parsing happens before the callback returns
+  // so the resident set size below includes the parsed model
+  callback(ads::Result::SUCCESS,
+      std::string(reinterpret_cast<const char*>(mapped_file.data()),
+          mapped_file.length()));
+
+  const base::TimeDelta load_time = base::TimeTicks::Now() - start_time;
+  UMA_HISTOGRAM_TIMES("Brave.Ads.UserModelLoadTime", load_time);
+
+  VLOG(1) << "Loaded " << mapped_file.length() << " byte user model in "
+          << load_time.InMilliseconds() << "ms, resident set size grew from "
+          << rss_before_kb << "KB to " << GetResidentSetSizeKB() << "KB";
 }
 
 void BatAdsClientMojoBridge::LoadUserModelForId(
@@ -168,7 +251,8 @@ void BatAdsClientMojoBridge::LoadUserModelForId(
   }
 
   bat_ads_client_->LoadUserModelForId(id,
-      base::BindOnce(&OnLoadUserModelForId, std::move(callback)));
+      base::BindOnce(&OnLoadUserModelForId, std::move(callback),
+          base::TimeTicks::Now()));
 }
 
 void BatAdsClientMojoBridge::RecordP2AEvent(
@@ -208,6 +292,7 @@ std::string BatAdsClientMojoBridge::LoadResourceForId(
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->LoadResourceForId(id, &value);
   return value;
 }
@@ -249,10 +334,15 @@ bool BatAdsClientMojoBridge::GetBooleanPref(
     const std::string& path) const {
   bool value = false;
 
+  if (const auto* pref = FindPref(path, base::Value::Type::BOOLEAN)) {
+    return pref->GetBool();
+  }
+
   if (!connected()) {
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->GetBooleanPref(path, &value);
   return value;
 }
@@ -260,6 +350,8 @@ bool BatAdsClientMojoBridge::GetBooleanPref(
 void BatAdsClientMojoBridge::SetBooleanPref(
     const std::string& path,
     const bool value) {
+  WritePref(path, base::Value(value));
+
   if (!connected()) {
     return;
   }
@@ -271,10 +363,15 @@ int BatAdsClientMojoBridge::GetIntegerPref(
     const std::string& path) const {
   int value = 0;
 
+  if (const auto* pref = FindPref(path, base::Value::Type::INTEGER)) {
+    return pref->GetInt();
+  }
+
   if (!connected()) {
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->GetIntegerPref(path, &value);
   return value;
 }
@@ -282,6 +379,8 @@ int BatAdsClientMojoBridge::GetIntegerPref(
 void BatAdsClientMojoBridge::SetIntegerPref(
     const std::string& path,
     const int value) {
+  WritePref(path, base::Value(value));
+
   if (!connected()) {
     return;
   }
@@ -293,10 +392,22 @@ double BatAdsClientMojoBridge::GetDoublePref(
     const std::string& path) const {
   double value = 0.0;
 
+  // Doubles without a fractional part arrive as integers
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_int()) {
+    ++mirrored_reads_;
+    return iter->second.GetInt();
+  }
+
+  if (const auto* pref = FindPref(path, base::Value::Type::DOUBLE)) {
+    return pref->GetDouble();
+  }
+
   if (!connected()) {
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->GetDoublePref(path, &value);
   return value;
 }
@@ -304,6 +415,8 @@ double BatAdsClientMojoBridge::GetDoublePref(
 void BatAdsClientMojoBridge::SetDoublePref(
     const std::string& path,
     const double value) {
+  WritePref(path, base::Value(value));
+
   if (!connected()) {
     return;
   }
@@ -315,10 +428,15 @@ std::string BatAdsClientMojoBridge::GetStringPref(
     const std::string& path) const {
   std::string value;
 
+  if (const auto* pref = FindPref(path, base::Value::Type::STRING)) {
+    return pref->GetString();
+  }
+
   if (!connected()) {
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->GetStringPref(path, &value);
   return value;
 }
@@ -326,6 +444,8 @@ std::string BatAdsClientMojoBridge::GetStringPref(
 void BatAdsClientMojoBridge::SetStringPref(
     const std::string& path,
     const std::string& value) {
+  WritePref(path, base::Value(value));
+
   if (!connected()) {
     return;
   }
@@ -337,10 +457,17 @@ int64_t BatAdsClientMojoBridge::GetInt64Pref(
     const std::string& path) const {
   int64_t value = 0;
 
+  // 64-bit integers are stored as strings in prefs
+  const auto* pref = FindPref(path, base::Value::Type::STRING);
+  if (pref && base::StringToInt64(pref->GetString(), &value)) {
+    return value;
+  }
+
   if (!connected()) {
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->GetInt64Pref(path, &value);
   return value;
 }
@@ -348,6 +475,8 @@ int64_t BatAdsClientMojoBridge::GetInt64Pref(
 void BatAdsClientMojoBridge::SetInt64Pref(
     const std::string& path,
     const int64_t value) {
+  WritePref(path, base::Value(base::NumberToString(value)));
+
   if (!connected()) {
     return;
   }
@@ -359,10 +488,17 @@ uint64_t BatAdsClientMojoBridge::GetUint64Pref(
     const std::string& path) const {
   uint64_t value = 0;
 
+  // 64-bit integers are stored as strings in prefs
+  const auto* pref = FindPref(path, base::Value::Type::STRING);
+  if (pref && base::StringToUint64(pref->GetString(), &value)) {
+    return value;
+  }
+
   if (!connected()) {
     return value;
   }
 
+  ++sync_calls_;
   bat_ads_client_->GetUint64Pref(path, &value);
   return value;
 }
@@ -370,6 +506,8 @@ uint64_t BatAdsClientMojoBridge::GetUint64Pref(
 void BatAdsClientMojoBridge::SetUint64Pref(
     const std::string& path,
     const uint64_t value) {
+  WritePref(path, base::Value(base::NumberToString(value)));
+
   if (!connected()) {
     return;
   }
@@ -379,6 +517,10 @@ void BatAdsClientMojoBridge::SetUint64Pref(
 
 void BatAdsClientMojoBridge::ClearPref(
     const std::string& path) {
+  // Reads fall back to a [Sync] call until the browser acknowledges the
+  // clear with the default value
+  WritePref(path, base::Value());
+
   if (!connected()) {
     return;
   }
@@ -392,4 +534,40 @@ bool BatAdsClientMojoBridge::connected() const {
   return bat_ads_client_.is_bound();
 }
 
+const base::Value* BatAdsClientMojoBridge::FindPref(
+    const std::string& path,
+    const base::Value::Type type) const {
+  const auto iter = prefs_.find(path);
+  if (iter == prefs_.end() || iter->second.type() != type) {
+    return nullptr;
+  }
+
+  ++mirrored_reads_;
+  return &iter->second;
+}
+
+void BatAdsClientMojoBridge::WritePref(
+    const std::string& path,
+    base::Value value) {
+  // Only writes sent to the browser are acknowledged
+  if (connected()) {
+    ++pending_writes_[path];
+  }
+
+  if (value.is_none()) {
+    prefs_.erase(path);
+    return;
+  }
+
+  prefs_[path] = std::move(value);
+}
+
+void BatAdsClientMojoBridge::ReportCallCounts() {
+  UMA_HISTOGRAM_COUNTS_10000("Brave.Ads.SyncIPCsPerMinute", sync_calls_);
+  UMA_HISTOGRAM_COUNTS_10000("Brave.Ads.MirroredReadsPerMinute",
+      mirrored_reads_);
+  sync_calls_ = 0;
+  mirrored_reads_ = 0;
+}
+
 }  // namespace bat_ads
@@ -10,6 +10,9 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
 #include "bat/ads/ads_client.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -28,6 +31,15 @@ class BatAdsClientMojoBridge
   BatAdsClientMojoBridge(const BatAdsClientMojoBridge&) = delete;
   BatAdsClientMojoBridge& operator=(const BatAdsClientMojoBridge&) = delete;
 
+  // Updates the local copy of the ads prefs, which is seeded by the browser
+  // before ads are initialized and then kept up to date on every change, so
+  // pref reads don't need a [Sync] call
+  void OnPrefsChanged(base::flat_map<std::string, base::Value> prefs);
+  // Applies the browser's value of |path| once every write of it made here
+  // has been acknowledged. Until then changes reported for |path| predate
+  // the local write and are dropped
+  void OnPrefWritten(const std::string& path, base::Value value);
+
   // AdsClient implementation
   bool CanShowBackgroundNotifications() const override;
 
@@ -127,7 +139,25 @@ class BatAdsClientMojoBridge
  private:
   bool connected() const;
 
+  // Returns the mirrored pref for |path| if it has |type|, otherwise null in
+  // which case the caller falls back to a [Sync] call
+  const base::Value* FindPref(
+      const std::string& path,
+      const base::Value::Type type) const;
+
+  void WritePref(const std::string& path, base::Value value);
+
+  void ReportCallCounts();
+
   mojo::AssociatedRemote<mojom::BatAdsClient> bat_ads_client_;
+
+  base::flat_map<std::string, base::Value> prefs_;
+  // Number of writes per pref path not yet acknowledged by the browser
+  base::flat_map<std::string, int> pending_writes_;
+
+  mutable int sync_calls_ = 0;
+  mutable int mirrored_reads_ = 0;
+  base::RepeatingTimer report_call_counts_timer_;
 };
 
 }  // namespace bat_ads
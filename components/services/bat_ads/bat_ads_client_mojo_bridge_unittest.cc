@@ -0,0 +1,198 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/bat_ads_client_mojo_bridge.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/containers/flat_map.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "bat/ads/pref_names.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom-test-utils.h"
+#include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatAdsClientMojoBridgeTest.*
+
+namespace bat_ads {
+
+namespace {
+
+class FakeBatAdsClient : public mojom::BatAdsClientInterceptorForTesting {
+ public:
+  FakeBatAdsClient() = default;
+  ~FakeBatAdsClient() override = default;
+
+  int get_pref_calls() const { return get_pref_calls_; }
+  int clear_pref_calls() const { return clear_pref_calls_; }
+
+  // mojom::BatAdsClientInterceptorForTesting:
+  mojom::BatAdsClient* GetForwardingInterface() override { return nullptr; }
+
+  void GetStringPref(const std::string& path,
+                     GetStringPrefCallback callback) override {
+    get_pref_calls_++;
+    std::move(callback).Run("browser");
+  }
+
+  void SetStringPref(const std::string& path,
+                     const std::string& value) override {}
+
+  void ClearPref(const std::string& path) override { clear_pref_calls_++; }
+
+ private:
+  int get_pref_calls_ = 0;
+  int clear_pref_calls_ = 0;
+};
+
+}  // namespace
+
+class BatAdsClientMojoBridgeTest : public testing::Test {
+ protected:
+  BatAdsClientMojoBridgeTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME) {
+    mojo::AssociatedRemote<mojom::BatAdsClient> remote;
+    receiver_.Bind(remote.BindNewEndpointAndPassDedicatedReceiver());
+    bridge_ = std::make_unique<BatAdsClientMojoBridge>(remote.Unbind());
+  }
+
+  void SetPref(const std::string& path, base::Value value) {
+    base::flat_map<std::string, base::Value> prefs;
+    prefs.emplace(path, std::move(value));
+    bridge_->OnPrefsChanged(std::move(prefs));
+  }
+
+  void ReportCallCounts() {
+    task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  FakeBatAdsClient client_;
+  mojo::AssociatedReceiver<mojom::BatAdsClient> receiver_{&client_};
+  std::unique_ptr<BatAdsClientMojoBridge> bridge_;
+};
+
+TEST_F(BatAdsClientMojoBridgeTest, ReadMirroredPrefWithoutSyncCall) {
+  // Arrange
+  base::HistogramTester histogram_tester;
+  SetPref(ads::prefs::kCatalogId, base::Value("mirrored"));
+
+  // Act
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+  ReportCallCounts();
+
+  // Assert
+  EXPECT_EQ("mirrored", value);
+  EXPECT_EQ(0, client_.get_pref_calls());
+  histogram_tester.ExpectUniqueSample("Brave.Ads.SyncIPCsPerMinute", 0, 1);
+  histogram_tester.ExpectUniqueSample("Brave.Ads.MirroredReadsPerMinute", 1, 1);
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, CountSyncCallForMissingPref) {
+  // Arrange
+  base::HistogramTester histogram_tester;
+
+  // Act
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+  ReportCallCounts();
+
+  // Assert
+  EXPECT_EQ("browser", value);
+  EXPECT_EQ(1, client_.get_pref_calls());
+  histogram_tester.ExpectUniqueSample("Brave.Ads.SyncIPCsPerMinute", 1, 1);
+  histogram_tester.ExpectUniqueSample("Brave.Ads.MirroredReadsPerMinute", 0, 1);
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, ReadWrittenPrefWithoutSyncCall) {
+  // Arrange
+  bridge_->SetStringPref(ads::prefs::kCatalogId, "written");
+
+  // Act
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+
+  // Assert
+  EXPECT_EQ("written", value);
+  EXPECT_EQ(0, client_.get_pref_calls());
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, ReadClearedPrefWithSyncCall) {
+  // Arrange
+  SetPref(ads::prefs::kCatalogId, base::Value("mirrored"));
+
+  // Act
+  bridge_->ClearPref(ads::prefs::kCatalogId);
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+
+  // Assert
+  EXPECT_EQ("browser", value);
+  EXPECT_EQ(1, client_.clear_pref_calls());
+  EXPECT_EQ(1, client_.get_pref_calls());
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, DropPrefChangedBeforeWriteIsAcknowledged) {
+  // Arrange
+  bridge_->SetStringPref(ads::prefs::kCatalogId, "written");
+
+  // Act
+  SetPref(ads::prefs::kCatalogId, base::Value("stale"));
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+
+  // Assert
+  EXPECT_EQ("written", value);
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, ApplyPrefChangedAfterWritesAreAcknowledged) {
+  // Arrange
+  bridge_->SetStringPref(ads::prefs::kCatalogId, "first");
+  bridge_->SetStringPref(ads::prefs::kCatalogId, "second");
+  bridge_->OnPrefWritten(ads::prefs::kCatalogId, base::Value("first"));
+  SetPref(ads::prefs::kCatalogId, base::Value("stale"));
+  bridge_->OnPrefWritten(ads::prefs::kCatalogId, base::Value("second"));
+
+  // Act
+  SetPref(ads::prefs::kCatalogId, base::Value("browser"));
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+
+  // Assert
+  EXPECT_EQ("browser", value);
+  EXPECT_EQ(0, client_.get_pref_calls());
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, ReadAcknowledgedClearWithoutSyncCall) {
+  // Arrange
+  SetPref(ads::prefs::kCatalogId, base::Value("mirrored"));
+
+  // Act
+  bridge_->ClearPref(ads::prefs::kCatalogId);
+  bridge_->OnPrefWritten(ads::prefs::kCatalogId, base::Value(""));
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+
+  // Assert
+  EXPECT_TRUE(value.empty());
+  EXPECT_EQ(0, client_.get_pref_calls());
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, DoNotCountSyncCallWhenDisconnected) {
+  // Arrange
+  base::HistogramTester histogram_tester;
+  receiver_.reset();
+  bridge_ = std::make_unique<BatAdsClientMojoBridge>(
+      mojo::PendingAssociatedRemote<mojom::BatAdsClient>());
+
+  // Act
+  const std::string value = bridge_->GetStringPref(ads::prefs::kCatalogId);
+  ReportCallCounts();
+
+  // Assert
+  EXPECT_TRUE(value.empty());
+  histogram_tester.ExpectUniqueSample("Brave.Ads.SyncIPCsPerMinute", 0, 1);
+}
+
+}  // namespace bat_ads
@@ -44,6 +44,15 @@ BatAdsImpl::BatAdsImpl(
 
 BatAdsImpl::~BatAdsImpl() = default;
 
+void BatAdsImpl::OnPrefsChanged(
+    base::flat_map<std::string, base::Value> prefs) {
+  bat_ads_client_mojo_proxy_->OnPrefsChanged(std::move(prefs));
+}
+
+void BatAdsImpl::OnPrefWritten(const std::string& path, base::Value value) {
+  bat_ads_client_mojo_proxy_->OnPrefWritten(path, std::move(value));
+}
+
 void BatAdsImpl::Initialize(
     InitializeCallback callback) {
   auto* holder = new CallbackHolder<InitializeCallback>(AsWeakPtr(),
@@ -12,7 +12,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "bat/ads/ads.h"
@@ -38,6 +40,10 @@ class BatAdsImpl :
   BatAdsImpl& operator=(const BatAdsImpl&) = delete;
 
   // Overridden from mojom::BatAds:
+  void OnPrefsChanged(
+      base::flat_map<std::string, base::Value> prefs) override;
+  void OnPrefWritten(const std::string& path, base::Value value) override;
+
   void Initialize(
       InitializeCallback callback) override;
   void Shutdown(
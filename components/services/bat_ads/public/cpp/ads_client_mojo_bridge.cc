@@ -22,9 +22,12 @@ using std::placeholders::_2;
 namespace bat_ads {
 
 AdsClientMojoBridge::AdsClientMojoBridge(
-    ads::AdsClient* ads_client)
-    : ads_client_(ads_client) {
+    ads::AdsClient* ads_client,
+    UserModelFileDelegate* user_model_file_delegate)
+    : ads_client_(ads_client),
+      user_model_file_delegate_(user_model_file_delegate) {
   DCHECK(ads_client_);
+  DCHECK(user_model_file_delegate_);
 }
 
 AdsClientMojoBridge::~AdsClientMojoBridge() = default;
@@ -111,13 +114,14 @@ void AdsClientMojoBridge::Log(
 
 // static
 void AdsClientMojoBridge::OnLoadUserModelForId(
-    CallbackHolder<LoadCallback>* holder,
-    const ads::Result result,
-    const std::string& value) {
+    CallbackHolder<LoadUserModelForIdCallback>* holder,
+    base::File file) {
   DCHECK(holder);
 
   if (holder->is_valid()) {
-    std::move(holder->get()).Run((int32_t)result, std::move(value));
+    const ads::Result result =
+        file.IsValid() ? ads::Result::SUCCESS : ads::Result::FAILED;
+    std::move(holder->get()).Run((int32_t)result, std::move(file));
   }
 
   delete holder;
@@ -125,12 +129,12 @@ void AdsClientMojoBridge::OnLoadUserModelForId(
 
 void AdsClientMojoBridge::LoadUserModelForId(
     const std::string& id,
-    LoadCallback callback) {
-  // this gets deleted in OnLoad
-  auto* holder =
-      new CallbackHolder<LoadCallback>(AsWeakPtr(), std::move(callback));
-  ads_client_->LoadUserModelForId(
-      id, std::bind(AdsClientMojoBridge::OnLoadUserModelForId, holder, _1, _2));
+    LoadUserModelForIdCallback callback) {
+  // this gets deleted in OnLoadUserModelForId
+  auto* holder = new CallbackHolder<LoadUserModelForIdCallback>(AsWeakPtr(),
+      std::move(callback));
+  user_model_file_delegate_->OpenUserModelFileForId(id,
+      base::BindOnce(&AdsClientMojoBridge::OnLoadUserModelForId, holder));
 }
 
 void AdsClientMojoBridge::RecordP2AEvent(
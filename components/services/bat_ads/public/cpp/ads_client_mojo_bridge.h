@@ -11,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/callback.h"
+#include "base/files/file.h"
 #include "base/memory/weak_ptr.h"
 #include "bat/ads/ads_client.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
@@ -22,8 +24,24 @@ class AdsClientMojoBridge
     : public mojom::BatAdsClient,
       public base::SupportsWeakPtr<AdsClientMojoBridge> {
  public:
-  explicit AdsClientMojoBridge(
-      ads::AdsClient* ads_client);
+  // Opens user models so that they can be passed to the ads service as files
+  class UserModelFileDelegate {
+   public:
+    using OpenUserModelFileForIdCallback =
+        base::OnceCallback<void(base::File file)>;
+
+    virtual ~UserModelFileDelegate() = default;
+
+    // |callback| should be run with an invalid file if the user model for |id|
+    // can't be opened for reading
+    virtual void OpenUserModelFileForId(
+        const std::string& id,
+        OpenUserModelFileForIdCallback callback) = 0;
+  };
+
+  AdsClientMojoBridge(
+      ads::AdsClient* ads_client,
+      UserModelFileDelegate* user_model_file_delegate);
 
   ~AdsClientMojoBridge() override;
 
@@ -62,7 +80,7 @@ class AdsClientMojoBridge
       const std::string& message) override;
   void LoadUserModelForId(
       const std::string& id,
-      LoadCallback callback) override;
+      LoadUserModelForIdCallback callback) override;
 
   void RecordP2AEvent(
       const std::string& name,
@@ -154,9 +172,8 @@ class AdsClientMojoBridge
   };
 
   static void OnLoadUserModelForId(
-      CallbackHolder<LoadCallback>* holder,
-      const ads::Result result,
-      const std::string& value);
+      CallbackHolder<LoadUserModelForIdCallback>* holder,
+      base::File file);
 
   static void OnLoad(
       CallbackHolder<LoadCallback>* holder,
@@ -176,6 +193,7 @@ class AdsClientMojoBridge
       ads::DBCommandResponsePtr response);
 
   ads::AdsClient* ads_client_;  // NOT OWNED
+  UserModelFileDelegate* user_model_file_delegate_;  // NOT OWNED
 };
 
 }  // namespace bat_ads
@@ -11,12 +11,25 @@
 #include <vector>
 
 #include "base/logging.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/strings/string_number_conversions.h"
+#include "bat/ledger/option_keys.h"
+#include "net/base/escape.h"
 
 namespace bat_ledger {
 
+namespace {
+
+constexpr base::TimeDelta kReportCallCountsInterval =
+    base::TimeDelta::FromMinutes(1);
+
+}  // namespace
+
 BatLedgerClientMojoBridge::BatLedgerClientMojoBridge(
       mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info) {
   bat_ledger_client_.Bind(std::move(client_info));
+  report_call_counts_timer_.Start(FROM_HERE, kReportCallCountsInterval, this,
+      &BatLedgerClientMojoBridge::ReportCallCounts);
 }
 
 BatLedgerClientMojoBridge::~BatLedgerClientMojoBridge() = default;
@@ -131,12 +144,7 @@ void BatLedgerClientMojoBridge::FetchFavIcon(const std::string& url,
 }
 
 std::string BatLedgerClientMojoBridge::URIEncode(const std::string& value) {
-  if (!Connected())
-    return "";
-
-  std::string encoded_value;
-  bat_ledger_client_->URIEncode(value, &encoded_value);
-  return encoded_value;
+  return net::EscapeQueryParamValue(value, false);
 }
 
 void BatLedgerClientMojoBridge::PublisherListNormalized(
@@ -148,121 +156,290 @@ void BatLedgerClientMojoBridge::PublisherListNormalized(
   bat_ledger_client_->PublisherListNormalized(std::move(list));
 }
 
+void BatLedgerClientMojoBridge::OnStateChanged(
+    base::flat_map<std::string, base::Value> state) {
+  for (auto& item : state) {
+    if (pending_writes_.count(item.first)) {
+      continue;
+    }
+
+    state_[item.first] = std::move(item.second);
+  }
+}
+
+void BatLedgerClientMojoBridge::OnStateWritten(const std::string& name,
+                                               base::Value value) {
+  const auto iter = pending_writes_.find(name);
+  if (iter != pending_writes_.end()) {
+    if (--iter->second > 0) {
+      return;
+    }
+
+    pending_writes_.erase(iter);
+  }
+
+  if (value.is_none()) {
+    state_.erase(name);
+    return;
+  }
+
+  state_[name] = std::move(value);
+}
+
+void BatLedgerClientMojoBridge::WriteState(const std::string& name,
+                                           base::Value value) {
+  ++pending_writes_[name];
+  if (value.is_none()) {
+    state_.erase(name);
+    return;
+  }
+
+  state_[name] = std::move(value);
+}
+
+const base::Value* BatLedgerClientMojoBridge::FindState(
+    const std::string& name,
+    const base::Value::Type type) const {
+  const auto iter = state_.find(name);
+  if (iter == state_.end() || iter->second.type() != type) {
+    return nullptr;
+  }
+
+  ++mirrored_reads_;
+  return &iter->second;
+}
+
 void BatLedgerClientMojoBridge::SetBooleanState(const std::string& name,
                                                bool value) {
+  WriteState(name, base::Value(value));
   bat_ledger_client_->SetBooleanState(name, value);
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanState(const std::string& name) const {
+  if (const auto* state = FindState(name, base::Value::Type::BOOLEAN)) {
+    return state->GetBool();
+  }
+
   bool value;
+  ++sync_calls_;
   bat_ledger_client_->GetBooleanState(name, &value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetIntegerState(const std::string& name,
                                                int value) {
+  WriteState(name, base::Value(value));
   bat_ledger_client_->SetIntegerState(name, value);
 }
 
 int BatLedgerClientMojoBridge::GetIntegerState(const std::string& name) const {
+  if (const auto* state = FindState(name, base::Value::Type::INTEGER)) {
+    return state->GetInt();
+  }
+
   int value;
+  ++sync_calls_;
   bat_ledger_client_->GetIntegerState(name, &value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetDoubleState(const std::string& name,
                                               double value) {
+  WriteState(name, base::Value(value));
   bat_ledger_client_->SetDoubleState(name, value);
 }
 
 double BatLedgerClientMojoBridge::GetDoubleState(
     const std::string& name) const {
+  // Doubles without a fractional part arrive as integers.
+  const auto iter = state_.find(name);
+  if (iter != state_.end() && iter->second.is_int()) {
+    ++mirrored_reads_;
+    return iter->second.GetInt();
+  }
+
+  if (const auto* state = FindState(name, base::Value::Type::DOUBLE)) {
+    return state->GetDouble();
+  }
+
   double value;
+  ++sync_calls_;
   bat_ledger_client_->GetDoubleState(name, &value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetStringState(const std::string& name,
                               const std::string& value) {
+  WriteState(name, base::Value(value));
   bat_ledger_client_->SetStringState(name, value);
 }
 
 std::string BatLedgerClientMojoBridge::
 GetStringState(const std::string& name) const {
+  if (const auto* state = FindState(name, base::Value::Type::STRING)) {
+    return state->GetString();
+  }
+
   std::string value;
+  ++sync_calls_;
   bat_ledger_client_->GetStringState(name, &value);
   return value;
 }
 
+// 64-bit integers are stored as strings in prefs.
 void BatLedgerClientMojoBridge::SetInt64State(const std::string& name,
                                              int64_t value) {
+  WriteState(name, base::Value(base::NumberToString(value)));
   bat_ledger_client_->SetInt64State(name, value);
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64State(
     const std::string& name) const {
   int64_t value;
+  const auto* state = FindState(name, base::Value::Type::STRING);
+  if (state && base::StringToInt64(state->GetString(), &value)) {
+    return value;
+  }
+
+  ++sync_calls_;
   bat_ledger_client_->GetInt64State(name, &value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetUint64State(const std::string& name,
                                               uint64_t value) {
+  WriteState(name, base::Value(base::NumberToString(value)));
   bat_ledger_client_->SetUint64State(name, value);
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64State(
     const std::string& name) const {
   uint64_t value;
+  const auto* state = FindState(name, base::Value::Type::STRING);
+  if (state && base::StringToUint64(state->GetString(), &value)) {
+    return value;
+  }
+
+  ++sync_calls_;
   bat_ledger_client_->GetUint64State(name, &value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::ClearState(const std::string& name) {
+  // Reads fall back to a [Sync] call until the browser acknowledges the
+  // clear with the default value.
+  WriteState(name, base::Value());
   bat_ledger_client_->ClearState(name);
 }
 
+const base::Value* BatLedgerClientMojoBridge::FindOption(
+    const std::string& name) const {
+  const auto iter = options_.find(name);
+  if (iter == options_.end()) {
+    return nullptr;
+  }
+
+  ++mirrored_reads_;
+  return &iter->second;
+}
+
+void BatLedgerClientMojoBridge::CacheOption(
+    const std::string& name,
+    base::Value value) const {
+  if (name == ledger::option::kContributionsDisabledForBAPMigration) {
+    return;
+  }
+
+  options_[name] = std::move(value);
+}
+
 bool BatLedgerClientMojoBridge::GetBooleanOption(
     const std::string& name) const {
+  if (const auto* option = FindOption(name)) {
+    return option->GetBool();
+  }
+
   bool value;
+  ++sync_calls_;
   bat_ledger_client_->GetBooleanOption(name, &value);
+  CacheOption(name, base::Value(value));
   return value;
 }
 
 int BatLedgerClientMojoBridge::GetIntegerOption(const std::string& name) const {
+  if (const auto* option = FindOption(name)) {
+    return option->GetInt();
+  }
+
   int value;
+  ++sync_calls_;
   bat_ledger_client_->GetIntegerOption(name, &value);
+  CacheOption(name, base::Value(value));
   return value;
 }
 
 double BatLedgerClientMojoBridge::GetDoubleOption(
     const std::string& name) const {
+  if (const auto* option = FindOption(name)) {
+    return option->GetDouble();
+  }
+
   double value;
+  ++sync_calls_;
   bat_ledger_client_->GetDoubleOption(name, &value);
+  CacheOption(name, base::Value(value));
   return value;
 }
 
 std::string BatLedgerClientMojoBridge::GetStringOption(
     const std::string& name) const {
+  if (const auto* option = FindOption(name)) {
+    return option->GetString();
+  }
+
   std::string value;
+  ++sync_calls_;
   bat_ledger_client_->GetStringOption(name, &value);
+  CacheOption(name, base::Value(value));
   return value;
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64Option(
     const std::string& name) const {
   int64_t value;
+  const auto* option = FindOption(name);
+  if (option && base::StringToInt64(option->GetString(), &value)) {
+    return value;
+  }
+
+  ++sync_calls_;
   bat_ledger_client_->GetInt64Option(name, &value);
+  CacheOption(name, base::Value(base::NumberToString(value)));
   return value;
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64Option(
     const std::string& name) const {
   uint64_t value;
+  const auto* option = FindOption(name);
+  if (option && base::StringToUint64(option->GetString(), &value)) {
+    return value;
+  }
+
+  ++sync_calls_;
   bat_ledger_client_->GetUint64Option(name, &value);
+  CacheOption(name, base::Value(base::NumberToString(value)));
   return value;
 }
 
+void BatLedgerClientMojoBridge::ReportCallCounts() {
+  UMA_HISTOGRAM_COUNTS_10000("Brave.Rewards.SyncIPCsPerMinute", sync_calls_);
+  UMA_HISTOGRAM_COUNTS_10000("Brave.Rewards.MirroredReadsPerMinute",
+                             mirrored_reads_);
+  sync_calls_ = 0;
+  mirrored_reads_ = 0;
+}
+
 bool BatLedgerClientMojoBridge::Connected() const {
   return bat_ledger_client_.is_bound();
 }
@@ -282,6 +459,7 @@ std::string BatLedgerClientMojoBridge::GetLegacyWallet() {
     return "";
   }
 
+  ++sync_calls_;
   std::string wallet;
   bat_ledger_client_->GetLegacyWallet(&wallet);
   return wallet;
@@ -304,8 +482,17 @@ void BatLedgerClientMojoBridge::ShowNotification(
 }
 
 ledger::type::ClientInfoPtr BatLedgerClientMojoBridge::GetClientInfo() {
+  // The client info describes the browser build and platform, it doesn't
+  // change while the ledger is running.
+  if (client_info_) {
+    ++mirrored_reads_;
+    return client_info_->Clone();
+  }
+
+  ++sync_calls_;
   auto info = ledger::type::ClientInfo::New();
   bat_ledger_client_->GetClientInfo(&info);
+  client_info_ = info->Clone();
   return info;
 }
 
@@ -373,6 +560,7 @@ void BatLedgerClientMojoBridge::DeleteLog(
 bool BatLedgerClientMojoBridge::SetEncryptedStringState(
     const std::string& name,
     const std::string& value) {
+  ++sync_calls_;
   bool success;
   bat_ledger_client_->SetEncryptedStringState(name, value, &success);
   return success;
@@ -380,6 +568,7 @@ bool BatLedgerClientMojoBridge::SetEncryptedStringState(
 
 std::string BatLedgerClientMojoBridge::GetEncryptedStringState(
     const std::string& name) {
+  ++sync_calls_;
   std::string value;
   bat_ledger_client_->GetEncryptedStringState(name, &value);
   return value;
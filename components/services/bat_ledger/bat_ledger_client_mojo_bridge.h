@@ -11,7 +11,10 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -31,6 +34,15 @@ class BatLedgerClientMojoBridge :
   BatLedgerClientMojoBridge& operator=(
       const BatLedgerClientMojoBridge&) = delete;
 
+  // Updates the local copy of the ledger state, which is seeded by the
+  // browser before the ledger is initialized and then kept up to date on
+  // every change, so state reads don't need a [Sync] call.
+  void OnStateChanged(base::flat_map<std::string, base::Value> state);
+  // Applies the browser's value of |name| once every write of it made here
+  // has been acknowledged. Until then changes reported for |name| predate
+  // the local write and are dropped.
+  void OnStateWritten(const std::string& name, base::Value value);
+
   void OnReconcileComplete(
       const ledger::type::Result result,
       ledger::type::ContributionInfoPtr contribution) override;
@@ -127,7 +139,32 @@ class BatLedgerClientMojoBridge :
  private:
   bool Connected() const;
 
+  // Returns the mirrored state for |name| if it has |type|, otherwise null in
+  // which case the caller falls back to a [Sync] call.
+  const base::Value* FindState(
+      const std::string& name,
+      const base::Value::Type type) const;
+
+  // Options don't change while the ledger is running, except for the BAP
+  // migration switch, so they are only asked for once.
+  const base::Value* FindOption(const std::string& name) const;
+  void CacheOption(const std::string& name, base::Value value) const;
+
+  void WriteState(const std::string& name, base::Value value);
+
+  void ReportCallCounts();
+
   mojo::AssociatedRemote<mojom::BatLedgerClient> bat_ledger_client_;
+
+  base::flat_map<std::string, base::Value> state_;
+  // Number of writes per state name not yet acknowledged by the browser.
+  base::flat_map<std::string, int> pending_writes_;
+  mutable base::flat_map<std::string, base::Value> options_;
+  ledger::type::ClientInfoPtr client_info_;
+
+  mutable int sync_calls_ = 0;
+  mutable int mirrored_reads_ = 0;
+  base::RepeatingTimer report_call_counts_timer_;
 };
 
 }  // namespace bat_ledger
@@ -0,0 +1,224 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ledger/bat_ledger_client_mojo_bridge.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/containers/flat_map.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "bat/ledger/option_keys.h"
+#include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom-test-utils.h"
+#include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatLedgerClientMojoBridgeTest.*
+
+namespace bat_ledger {
+
+namespace {
+
+constexpr char kState[] = "ac.min_visit_time";
+
+class FakeBatLedgerClient : public mojom::BatLedgerClientInterceptorForTesting {
+ public:
+  FakeBatLedgerClient() = default;
+  ~FakeBatLedgerClient() override = default;
+
+  int get_state_calls() const { return get_state_calls_; }
+  int get_option_calls() const { return get_option_calls_; }
+  int clear_state_calls() const { return clear_state_calls_; }
+
+  // mojom::BatLedgerClientInterceptorForTesting:
+  mojom::BatLedgerClient* GetForwardingInterface() override { return nullptr; }
+
+  void GetIntegerState(const std::string& name,
+                       GetIntegerStateCallback callback) override {
+    get_state_calls_++;
+    std::move(callback).Run(10);
+  }
+
+  void SetIntegerState(const std::string& name, int32_t value) override {}
+
+  void ClearState(const std::string& name) override { clear_state_calls_++; }
+
+  void GetBooleanOption(const std::string& name,
+                        GetBooleanOptionCallback callback) override {
+    get_option_calls_++;
+    std::move(callback).Run(true);
+  }
+
+ private:
+  int get_state_calls_ = 0;
+  int get_option_calls_ = 0;
+  int clear_state_calls_ = 0;
+};
+
+}  // namespace
+
+class BatLedgerClientMojoBridgeTest : public testing::Test {
+ protected:
+  BatLedgerClientMojoBridgeTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME) {
+    mojo::AssociatedRemote<mojom::BatLedgerClient> remote;
+    receiver_.Bind(remote.BindNewEndpointAndPassDedicatedReceiver());
+    bridge_ = std::make_unique<BatLedgerClientMojoBridge>(remote.Unbind());
+  }
+
+  void SetState(const std::string& name, base::Value value) {
+    base::flat_map<std::string, base::Value> state;
+    state.emplace(name, std::move(value));
+    bridge_->OnStateChanged(std::move(state));
+  }
+
+  void ReportCallCounts() {
+    task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  FakeBatLedgerClient client_;
+  mojo::AssociatedReceiver<mojom::BatLedgerClient> receiver_{&client_};
+  std::unique_ptr<BatLedgerClientMojoBridge> bridge_;
+};
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadMirroredStateWithoutSyncCall) {
+  // Arrange
+  base::HistogramTester histogram_tester;
+  SetState(kState, base::Value(8));
+
+  // Act
+  const int value = bridge_->GetIntegerState(kState);
+  ReportCallCounts();
+
+  // Assert
+  EXPECT_EQ(8, value);
+  EXPECT_EQ(0, client_.get_state_calls());
+  histogram_tester.ExpectUniqueSample("Brave.Rewards.SyncIPCsPerMinute", 0, 1);
+  histogram_tester.ExpectUniqueSample("Brave.Rewards.MirroredReadsPerMinute", 1,
+                                      1);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, CountSyncCallForMissingState) {
+  // Arrange
+  base::HistogramTester histogram_tester;
+
+  // Act
+  const int value = bridge_->GetIntegerState(kState);
+  ReportCallCounts();
+
+  // Assert
+  EXPECT_EQ(10, value);
+  EXPECT_EQ(1, client_.get_state_calls());
+  histogram_tester.ExpectUniqueSample("Brave.Rewards.SyncIPCsPerMinute", 1, 1);
+  histogram_tester.ExpectUniqueSample("Brave.Rewards.MirroredReadsPerMinute", 0,
+                                      1);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadWrittenStateWithoutSyncCall) {
+  // Arrange
+  bridge_->SetIntegerState(kState, 5);
+
+  // Act
+  const int value = bridge_->GetIntegerState(kState);
+
+  // Assert
+  EXPECT_EQ(5, value);
+  EXPECT_EQ(0, client_.get_state_calls());
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadClearedStateWithSyncCall) {
+  // Arrange
+  SetState(kState, base::Value(8));
+
+  // Act
+  bridge_->ClearState(kState);
+  const int value = bridge_->GetIntegerState(kState);
+
+  // Assert
+  EXPECT_EQ(10, value);
+  EXPECT_EQ(1, client_.clear_state_calls());
+  EXPECT_EQ(1, client_.get_state_calls());
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest,
+       DropStateChangedBeforeWriteIsAcknowledged) {
+  // Arrange
+  bridge_->SetIntegerState(kState, 5);
+
+  // Act
+  SetState(kState, base::Value(8));
+  const int value = bridge_->GetIntegerState(kState);
+
+  // Assert
+  EXPECT_EQ(5, value);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest,
+       ApplyStateChangedAfterWritesAreAcknowledged) {
+  // Arrange
+  bridge_->SetIntegerState(kState, 5);
+  bridge_->SetIntegerState(kState, 6);
+  bridge_->OnStateWritten(kState, base::Value(5));
+  SetState(kState, base::Value(8));
+  bridge_->OnStateWritten(kState, base::Value(6));
+
+  // Act
+  SetState(kState, base::Value(9));
+  const int value = bridge_->GetIntegerState(kState);
+
+  // Assert
+  EXPECT_EQ(9, value);
+  EXPECT_EQ(0, client_.get_state_calls());
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadAcknowledgedClearWithoutSyncCall) {
+  // Arrange
+  SetState(kState, base::Value(8));
+
+  // Act
+  bridge_->ClearState(kState);
+  bridge_->OnStateWritten(kState, base::Value(0));
+  const int value = bridge_->GetIntegerState(kState);
+
+  // Assert
+  EXPECT_EQ(0, value);
+  EXPECT_EQ(0, client_.get_state_calls());
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, CacheOptions) {
+  // Arrange
+  base::HistogramTester histogram_tester;
+
+  // Act
+  EXPECT_TRUE(bridge_->GetBooleanOption(ledger::option::kClaimUGP));
+  EXPECT_TRUE(bridge_->GetBooleanOption(ledger::option::kClaimUGP));
+  ReportCallCounts();
+
+  // Assert
+  EXPECT_EQ(1, client_.get_option_calls());
+  histogram_tester.ExpectUniqueSample("Brave.Rewards.SyncIPCsPerMinute", 1, 1);
+  histogram_tester.ExpectUniqueSample("Brave.Rewards.MirroredReadsPerMinute", 1,
+                                      1);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, DoNotCacheBAPMigrationOption) {
+  // Arrange
+
+  // Act
+  bridge_->GetBooleanOption(
+      ledger::option::kContributionsDisabledForBAPMigration);
+  bridge_->GetBooleanOption(
+      ledger::option::kContributionsDisabledForBAPMigration);
+
+  // Assert
+  EXPECT_EQ(2, client_.get_option_calls());
+}
+
+}  // namespace bat_ledger
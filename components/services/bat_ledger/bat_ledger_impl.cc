@@ -31,6 +31,16 @@ BatLedgerImpl::BatLedgerImpl(
 
 BatLedgerImpl::~BatLedgerImpl() = default;
 
+void BatLedgerImpl::OnStateChanged(
+    base::flat_map<std::string, base::Value> state) {
+  bat_ledger_client_mojo_bridge_->OnStateChanged(std::move(state));
+}
+
+void BatLedgerImpl::OnStateWritten(const std::string& name,
+                                   base::Value value) {
+  bat_ledger_client_mojo_bridge_->OnStateWritten(name, std::move(value));
+}
+
 void BatLedgerImpl::OnInitialize(
     CallbackHolder<InitializeCallback>* holder,
     ledger::type::Result result) {
@@ -537,6 +547,33 @@ void BatLedgerImpl::GetActivityInfoList(
       std::bind(BatLedgerImpl::OnGetActivityInfoList, holder, _1));
 }
 
+// static
+void BatLedgerImpl::OnGetActivityInfoPage(
+    CallbackHolder<GetActivityInfoPageCallback>* holder,
+    ledger::type::PublisherInfoList list,
+    const uint32_t total) {
+  DCHECK(holder);
+  if (holder->is_valid())
+    std::move(holder->get()).Run(std::move(list), total);
+
+  delete holder;
+}
+
+void BatLedgerImpl::GetActivityInfoPage(
+    uint32_t start,
+    uint32_t limit,
+    ledger::type::ActivityInfoFilterPtr filter,
+    GetActivityInfoPageCallback callback) {
+  auto* holder = new CallbackHolder<GetActivityInfoPageCallback>(
+      AsWeakPtr(), std::move(callback));
+
+  ledger_->GetActivityInfoPage(
+      start,
+      limit,
+      std::move(filter),
+      std::bind(BatLedgerImpl::OnGetActivityInfoPage, holder, _1, _2));
+}
+
 // static
 void BatLedgerImpl::OnGetExcludedList(
     CallbackHolder<GetExcludedListCallback>* holder,
@@ -15,6 +15,7 @@
 
 #include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "bat/ledger/ledger.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 
@@ -34,6 +35,10 @@ class BatLedgerImpl :
   BatLedgerImpl& operator=(const BatLedgerImpl&) = delete;
 
   // bat_ledger::mojom::BatLedger
+  void OnStateChanged(
+      base::flat_map<std::string, base::Value> state) override;
+  void OnStateWritten(const std::string& name, base::Value value) override;
+
   void Initialize(
     const bool execute_create_script,
     InitializeCallback callback) override;
@@ -147,6 +152,12 @@ class BatLedgerImpl :
     ledger::type::ActivityInfoFilterPtr filter,
     GetActivityInfoListCallback callback) override;
 
+  void GetActivityInfoPage(
+    uint32_t start,
+    uint32_t limit,
+    ledger::type::ActivityInfoFilterPtr filter,
+    GetActivityInfoPageCallback callback) override;
+
   void GetExcludedList(GetExcludedListCallback callback) override;
 
   void SaveMediaInfo(
@@ -350,6 +361,11 @@ class BatLedgerImpl :
     CallbackHolder<GetActivityInfoListCallback>* holder,
     ledger::type::PublisherInfoList list);
 
+  static void OnGetActivityInfoPage(
+    CallbackHolder<GetActivityInfoPageCallback>* holder,
+    ledger::type::PublisherInfoList list,
+    const uint32_t total);
+
   static void OnGetExcludedList(
       CallbackHolder<GetExcludedListCallback>* holder,
       ledger::type::PublisherInfoList list);
@@ -44,9 +44,6 @@ class LedgerClientMojoBridge :
       ledger::type::PublisherInfoPtr info,
       uint64_t window_id) override;
 
-  void URIEncode(const std::string& value,
-      URIEncodeCallback callback) override;
-
   void LoadURL(
       ledger::type::UrlRequestPtr request,
       LoadURLCallback callback) override;
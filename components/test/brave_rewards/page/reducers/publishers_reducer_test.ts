@@ -6,6 +6,21 @@
 import reducers from '../../../../brave_rewards/resources/page/reducers/index'
 import { types } from '../../../../brave_rewards/resources/page/constants/rewards_types'
 import { defaultState } from '../../../../brave_rewards/resources/page/storage'
+import { contributeListPageSize } from '../../../../brave_rewards/resources/page/constants/rewards_constants'
+import { getMockChrome } from '../../../testData'
+
+const publisher = (key: string, percentage: number) => ({
+  publisherKey: key,
+  percentage,
+  status: 0,
+  excluded: 0,
+  url: `https://${key}`,
+  name: key,
+  provider: '',
+  favIcon: '',
+  id: key,
+  weight: 0
+} as Rewards.Publisher)
 
 describe('publishers reducer', () => {
   describe('ON_EXCLUDED_LIST', () => {
@@ -78,4 +93,132 @@ describe('publishers reducer', () => {
       })
     })
   })
+
+  describe('ON_CONTRIBUTE_LIST_PAGE', () => {
+    let chromeSpy: jest.SpyInstance
+
+    (global as any).chrome = getMockChrome()
+
+    beforeEach(() => {
+      chromeSpy = jest.spyOn(chrome, 'send')
+    })
+
+    afterEach(() => {
+      chromeSpy.mockRestore()
+    })
+
+    it('replaces the list with the first page', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [publisher('foo.com', 50)]
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_PAGE,
+        payload: {
+          page: {
+            start: 0,
+            total: 3,
+            list: [publisher('bar.com', 60), publisher('baz.com', 30)]
+          }
+        }
+      })
+
+      expect(assertion.rewardsData.autoContributeList).toEqual([
+        publisher('bar.com', 60),
+        publisher('baz.com', 30)
+      ])
+      expect(assertion.rewardsData.autoContributeListTotal).toEqual(3)
+    })
+
+    it('appends later pages', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [
+        publisher('bar.com', 60),
+        publisher('baz.com', 30)
+      ]
+      initialState.autoContributeListTotal = 3
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_PAGE,
+        payload: {
+          page: {
+            start: 2,
+            total: 3,
+            list: [publisher('foo.com', 10)]
+          }
+        }
+      })
+
+      expect(assertion.rewardsData.autoContributeList).toEqual([
+        publisher('bar.com', 60),
+        publisher('baz.com', 30),
+        publisher('foo.com', 10)
+      ])
+      expect(chromeSpy).toHaveBeenCalledTimes(0)
+    })
+
+    it('does not request more after the first page', () => {
+      reducers({ rewardsData: { ...defaultState } }, {
+        type: types.ON_CONTRIBUTE_LIST_PAGE,
+        payload: {
+          page: {
+            start: 0,
+            total: 3,
+            list: [publisher('bar.com', 60)]
+          }
+        }
+      })
+
+      expect(chromeSpy).toHaveBeenCalledTimes(0)
+    })
+
+    it('requests the next page until the list is complete', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [publisher('bar.com', 60)]
+      initialState.autoContributeListTotal = 3
+
+      reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_PAGE,
+        payload: {
+          page: {
+            start: 1,
+            total: 3,
+            list: [publisher('baz.com', 30)]
+          }
+        }
+      })
+
+      expect(chromeSpy).toHaveBeenCalledTimes(1)
+      expect(chromeSpy).toHaveBeenCalledWith('brave_rewards.getContributionList', [2, contributeListPageSize])
+    })
+  })
+
+  describe('ON_CONTRIBUTE_LIST_CHANGED', () => {
+    it('merges changed and removed publishers', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [
+        publisher('bar.com', 60),
+        publisher('baz.com', 30),
+        publisher('foo.com', 10)
+      ]
+      initialState.autoContributeListTotal = 3
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_CHANGED,
+        payload: {
+          delta: {
+            total: 3,
+            changed: [publisher('foo.com', 45), publisher('qux.com', 5)],
+            removed: ['baz.com']
+          }
+        }
+      })
+
+      expect(assertion.rewardsData.autoContributeList).toEqual([
+        publisher('bar.com', 60),
+        publisher('foo.com', 45),
+        publisher('qux.com', 5)
+      ])
+      expect(assertion.rewardsData.autoContributeListTotal).toEqual(3)
+    })
+  })
 })
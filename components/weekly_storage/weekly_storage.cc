@@ -37,7 +37,9 @@ WeeklyStorage::WeeklyStorage(PrefService* prefs,
   Load();
 }
 
-WeeklyStorage::~WeeklyStorage() = default;
+WeeklyStorage::~WeeklyStorage() {
+  Flush();
+}
 
 void WeeklyStorage::AddDelta(uint64_t delta) {
   FilterToWeek();
@@ -92,6 +94,23 @@ uint64_t WeeklyStorage::GetHighestValueInWeek() const {
   return highest_it->value;
 }
 
+void WeeklyStorage::Flush() {
+  if (!has_pending_save_) {
+    return;
+  }
+  has_pending_save_ = false;
+
+  ListPrefUpdate update(prefs_, pref_name_);
+  base::ListValue* list = update.Get();
+  list->Clear();
+  for (const auto& u : daily_values_) {
+    base::DictionaryValue value;
+    value.SetKey("day", base::Value(u.day.ToDoubleT()));
+    value.SetDoubleKey("value", u.value);
+    list->Append(std::move(value));
+  }
+}
+
 bool WeeklyStorage::IsOneWeekPassed() const {
   // TODO(iefremov): This is not true 100% (if the browser was launched once
   // per week just after installation, for example).
@@ -140,14 +159,8 @@ void WeeklyStorage::Save() {
   DCHECK(!daily_values_.empty());
   DCHECK_LE(daily_values_.size(), kDaysInWeek);
 
-  ListPrefUpdate update(prefs_, pref_name_);
-  base::ListValue* list = update.Get();
-  // TODO(iefremov): Optimize if needed.
-  list->Clear();
-  for (const auto& u : daily_values_) {
-    base::DictionaryValue value;
-    value.SetKey("day", base::Value(u.day.ToDoubleT()));
-    value.SetDoubleKey("value", u.value);
-    list->Append(std::move(value));
+  has_pending_save_ = true;
+  if (!defer_saves_) {
+    Flush();
   }
 }
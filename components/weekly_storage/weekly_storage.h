@@ -41,6 +41,12 @@ class WeeklyStorage {
   uint64_t GetHighestValueInWeek() const;
   bool IsOneWeekPassed() const;
 
+  // When set, changes are accumulated in memory and written to prefs only on
+  // |Flush| or destruction, instead of on every change.
+  void set_defer_saves(bool defer_saves) { defer_saves_ = defer_saves; }
+  bool has_pending_save() const { return has_pending_save_; }
+  void Flush();
+
  private:
   struct DailyValue {
     base::Time day;
@@ -55,6 +61,9 @@ class WeeklyStorage {
   std::unique_ptr<base::Clock> clock_;
 
   std::list<DailyValue> daily_values_;
+
+  bool defer_saves_ = false;
+  bool has_pending_save_ = false;
 };
 
 #endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
@@ -0,0 +1,57 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/weekly_storage/weekly_storage_registry.h"
+
+#include "base/time/time.h"
+#include "brave/components/weekly_storage/weekly_storage.h"
+#include "components/prefs/pref_service.h"
+
+namespace {
+constexpr base::TimeDelta kFlushDelay = base::TimeDelta::FromSeconds(30);
+}
+
+WeeklyStorageRegistry::WeeklyStorageRegistry(PrefService* prefs)
+    : prefs_(prefs) {
+  DCHECK(prefs_);
+}
+
+WeeklyStorageRegistry::~WeeklyStorageRegistry() {
+  Flush();
+}
+
+WeeklyStorage* WeeklyStorageRegistry::Get(const std::string& pref_name) {
+  if (!prefs_)
+    return nullptr;
+
+  DCHECK(prefs_->FindPreference(pref_name));
+
+  auto it = storages_.find(pref_name);
+  if (it == storages_.end()) {
+    it = storages_.emplace(pref_name, nullptr).first;
+    it->second = std::make_unique<WeeklyStorage>(prefs_, it->first.c_str());
+    it->second->set_defer_saves(true);
+  }
+
+  if (!flush_timer_.IsRunning()) {
+    flush_timer_.Start(FROM_HERE, kFlushDelay, this,
+                       &WeeklyStorageRegistry::Flush);
+  }
+
+  return it->second.get();
+}
+
+void WeeklyStorageRegistry::Flush() {
+  flush_timer_.Stop();
+  for (const auto& storage : storages_) {
+    storage.second->Flush();
+  }
+}
+
+void WeeklyStorageRegistry::Shutdown() {
+  Flush();
+  storages_.clear();
+  prefs_ = nullptr;
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_REGISTRY_H_
+#define BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_REGISTRY_H_
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "base/timer/timer.h"
+#include "components/keyed_service/core/keyed_service.h"
+
+class PrefService;
+class WeeklyStorage;
+
+// Owns one long-lived WeeklyStorage per pref name for a PrefService, so that
+// frequently recorded metrics (per page load, per ad event) don't reload and
+// rewrite their pref on every event. Changes are accumulated in memory and
+// flushed to prefs shortly after they are made and on shutdown.
+class WeeklyStorageRegistry : public KeyedService {
+ public:
+  explicit WeeklyStorageRegistry(PrefService* prefs);
+  ~WeeklyStorageRegistry() override;
+
+  WeeklyStorageRegistry(const WeeklyStorageRegistry&) = delete;
+  WeeklyStorageRegistry& operator=(const WeeklyStorageRegistry&) = delete;
+
+  // Returns the storage for |pref_name|, which must be a registered list pref.
+  // Changes made to the returned storage are flushed to prefs after a short
+  // delay. Returns nullptr after Shutdown(). The returned storage is owned by
+  // the registry, so callers should look it up on each use rather than hold on
+  // to it.
+  WeeklyStorage* Get(const std::string& pref_name);
+
+  // Writes all pending changes to prefs.
+  void Flush();
+
+  PrefService* prefs() const { return prefs_; }
+
+  // KeyedService:
+  void Shutdown() override;
+
+ private:
+  PrefService* prefs_ = nullptr;
+  // std::map keeps keys at stable addresses, WeeklyStorage holds on to the
+  // pref name.
+  std::map<std::string, std::unique_ptr<WeeklyStorage>> storages_;
+  base::OneShotTimer flush_timer_;
+};
+
+#endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_REGISTRY_H_
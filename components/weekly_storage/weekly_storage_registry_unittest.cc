@@ -0,0 +1,96 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/weekly_storage/weekly_storage_registry.h"
+
+#include <memory>
+
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "brave/components/weekly_storage/weekly_storage.h"
+#include "components/prefs/pref_registry_simple.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+constexpr char kPrefName[] = "brave.weekly_test";
+constexpr char kOtherPrefName[] = "brave.weekly_test_other";
+}  // namespace
+
+class WeeklyStorageRegistryTest : public ::testing::Test {
+ public:
+  WeeklyStorageRegistryTest() {
+    pref_service_.registry()->RegisterListPref(kPrefName);
+    pref_service_.registry()->RegisterListPref(kOtherPrefName);
+    registry_ = std::make_unique<WeeklyStorageRegistry>(&pref_service_);
+  }
+
+ protected:
+  bool IsPrefEmpty(const char* pref_name) {
+    return pref_service_.GetList(pref_name)->GetList().empty();
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  TestingPrefServiceSimple pref_service_;
+  std::unique_ptr<WeeklyStorageRegistry> registry_;
+};
+
+TEST_F(WeeklyStorageRegistryTest, ReturnsSameStoragePerPref) {
+  WeeklyStorage* storage = registry_->Get(kPrefName);
+  EXPECT_EQ(storage, registry_->Get(kPrefName));
+  EXPECT_NE(storage, registry_->Get(kOtherPrefName));
+}
+
+TEST_F(WeeklyStorageRegistryTest, MatchesDirectWeeklyStorage) {
+  registry_->Get(kPrefName)->AddDelta(10);
+  registry_->Get(kPrefName)->AddDelta(20);
+  registry_->Get(kPrefName)->AddDelta(30);
+  registry_->Flush();
+
+  // The same deltas recorded the old way, one WeeklyStorage per event.
+  for (uint64_t delta : {10, 20, 30}) {
+    WeeklyStorage storage(&pref_service_, kOtherPrefName);
+    storage.AddDelta(delta);
+  }
+
+  EXPECT_EQ(registry_->Get(kPrefName)->GetWeeklySum(), 60ULL);
+  EXPECT_EQ(WeeklyStorage(&pref_service_, kPrefName).GetWeeklySum(),
+            WeeklyStorage(&pref_service_, kOtherPrefName).GetWeeklySum());
+}
+
+TEST_F(WeeklyStorageRegistryTest, FlushesAfterDelay) {
+  registry_->Get(kPrefName)->AddDelta(10);
+  registry_->Get(kPrefName)->AddDelta(10);
+  EXPECT_TRUE(IsPrefEmpty(kPrefName));
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  EXPECT_TRUE(IsPrefEmpty(kPrefName));
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  EXPECT_FALSE(IsPrefEmpty(kPrefName));
+  EXPECT_EQ(WeeklyStorage(&pref_service_, kPrefName).GetWeeklySum(), 20ULL);
+}
+
+TEST_F(WeeklyStorageRegistryTest, FlushesOnShutdown) {
+  registry_->Get(kPrefName)->AddDelta(10);
+  registry_->Get(kOtherPrefName)->ReplaceTodaysValueIfGreater(5);
+
+  registry_->Shutdown();
+
+  EXPECT_EQ(WeeklyStorage(&pref_service_, kPrefName).GetWeeklySum(), 10ULL);
+  EXPECT_EQ(
+      WeeklyStorage(&pref_service_, kOtherPrefName).GetHighestValueInWeek(),
+      5ULL);
+}
+
+TEST_F(WeeklyStorageRegistryTest, ReturnsNullAfterShutdown) {
+  registry_->Get(kPrefName)->AddDelta(10);
+
+  registry_->Shutdown();
+
+  EXPECT_EQ(registry_->Get(kPrefName), nullptr);
+  EXPECT_EQ(WeeklyStorage(&pref_service_, kPrefName).GetWeeklySum(), 10ULL);
+}
@@ -138,3 +138,17 @@ TEST_F(WeeklyStorageTest, GetsHighestValueInWeekFromReplacement) {
   // Sanity check disparate days were not replaced
   EXPECT_EQ(state_->GetWeeklySum(), high_value + low_value);
 }
+
+TEST_F(WeeklyStorageTest, DefersSavesUntilFlush) {
+  constexpr char kPrefName[] = "brave.weekly_test";
+  state_->set_defer_saves(true);
+  state_->AddDelta(10);
+  state_->AddDelta(20);
+  EXPECT_TRUE(state_->has_pending_save());
+  EXPECT_TRUE(pref_service_.GetList(kPrefName)->GetList().empty());
+
+  state_->Flush();
+  EXPECT_FALSE(state_->has_pending_save());
+  WeeklyStorage reloaded(&pref_service_, kPrefName);
+  EXPECT_EQ(reloaded.GetWeeklySum(), 30ULL);
+}